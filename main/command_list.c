@@ -0,0 +1,398 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Render Command List Implementation
+//==================================================================
+
+#include "command_list.h"
+#include "vector_math.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <string.h>
+
+// The frame's commands, kept until ResetRenderCommands
+static RenderCommandList frameList;
+static int submittedCount = 0;
+
+// Stand-ins for replayed commands, one per distinct recorded mesh/shader
+static Mesh replayMeshes[MAX_RENDER_COMMANDS];
+static Material replayMaterials[MAX_RENDER_COMMANDS];
+
+static RenderCommandStats commandStats = { .backend = RENDER_BACKEND_RAYLIB };
+
+static void ExecuteCommand(const RenderCommand* command)
+{
+    const InstanceData* instances = &frameList.instances[command->firstInstance];
+
+    if (command->state)
+    {
+        rlDrawRenderBatchActive();
+        if (command->state & RENDER_STATE_NO_DEPTH_WRITE) rlDisableDepthMask();
+        if (command->state & RENDER_STATE_NO_CULLING) rlDisableBackfaceCulling();
+    }
+
+    if (command->type == RENDER_COMMAND_INSTANCES)
+    {
+        DrawInstances(*command->mesh, command->textureId, instances, command->instanceCount);
+    }
+    else
+    {
+        const float* t = instances->transform;
+        Matrix transform = {
+            t[0], t[4], t[8],  t[12],
+            t[1], t[5], t[9],  t[13],
+            t[2], t[6], t[10], t[14],
+            t[3], t[7], t[11], t[15]
+        };
+
+        // Shares the caller's map array, as drawing the material directly would
+        Material material = *command->material;
+        if (command->textureId) material.maps[MATERIAL_MAP_DIFFUSE].texture.id = command->textureId;
+        material.maps[MATERIAL_MAP_DIFFUSE].color = instances->color;
+        DrawMesh(*command->mesh, material, transform);
+    }
+
+    if (command->state)
+    {
+        rlDrawRenderBatchActive();
+        if (command->state & RENDER_STATE_NO_DEPTH_WRITE) rlEnableDepthMask();
+        if (command->state & RENDER_STATE_NO_CULLING) rlEnableBackfaceCulling();
+    }
+}
+
+void SubmitRenderCommands()
+{
+    if (submittedCount == frameList.commandCount) return;
+
+    if (commandStats.backend == RENDER_BACKEND_RAYLIB)
+    {
+        for (int i = submittedCount; i < frameList.commandCount; i++) ExecuteCommand(&frameList.commands[i]);
+    }
+
+    submittedCount = frameList.commandCount;
+    commandStats.submits++;
+}
+
+// A full frame list is flushed early and its record restarts; a
+// recorded list can't submit, so it drops the command instead
+static bool ReserveCommand(RenderCommandList* list, int instances)
+{
+    if (instances > RENDER_INSTANCE_CAPACITY) return false;
+
+    if (list->commandCount < MAX_RENDER_COMMANDS &&
+        list->instanceCount + instances <= RENDER_INSTANCE_CAPACITY) return true;
+
+    if (list != &frameList)
+    {
+        list->overflows++;
+        return false;
+    }
+
+    SubmitRenderCommands();
+    frameList.commandCount = 0;
+    frameList.instanceCount = 0;
+    submittedCount = 0;
+    commandStats.overflows++;
+    return true;
+}
+
+static void AddCommand(RenderCommandList* list, RenderCommand command)
+{
+    list->commands[list->commandCount++] = command;
+    if (list != &frameList) return;
+
+    // Only the frame list counts: recorded commands count when submitted
+    if (list->commandCount > 1)
+    {
+        const RenderCommand* previous = &list->commands[list->commandCount - 2];
+        if (previous->mesh != command.mesh || previous->material != command.material ||
+            previous->textureId != command.textureId || previous->state != command.state)
+        {
+            commandStats.stateChanges++;
+        }
+    }
+    else
+    {
+        commandStats.stateChanges++;
+    }
+
+    commandStats.commands++;
+    commandStats.instances += command.instanceCount;
+    commandStats.triangles += command.mesh->triangleCount * command.instanceCount;
+}
+
+// Copies the command with its instances to the end of the list
+static void CopyCommand(RenderCommandList* list, RenderCommand command, const InstanceData* instances)
+{
+    if (!ReserveCommand(list, command.instanceCount)) return;
+
+    memcpy(&list->instances[list->instanceCount], instances, (size_t)command.instanceCount * sizeof(InstanceData));
+    command.firstInstance = list->instanceCount;
+    list->instanceCount += command.instanceCount;
+    AddCommand(list, command);
+}
+
+void ResetRenderCommands()
+{
+    frameList.commandCount = 0;
+    frameList.instanceCount = 0;
+    submittedCount = 0;
+
+    RenderBackend backend = commandStats.backend;
+    commandStats = (RenderCommandStats){0};
+    commandStats.backend = backend;
+}
+
+void ClearCommandList(RenderCommandList* list)
+{
+    list->commandCount = 0;
+    list->instanceCount = 0;
+    list->overflows = 0;
+}
+
+void RecordMeshCommand(RenderCommandList* list, RenderPass pass, const Mesh* mesh, const Material* material,
+                       unsigned int textureId, Color color, Matrix transform, unsigned char state)
+{
+    if (!list || !mesh || !material) return;
+
+    InstanceData instance;
+    MatrixToFloats(transform, instance.transform);
+    instance.color = color;
+    instance.uvRect[0] = 0.0f;
+    instance.uvRect[1] = 0.0f;
+    instance.uvRect[2] = 1.0f;
+    instance.uvRect[3] = 1.0f;
+
+    RenderCommand command = {
+        .type = RENDER_COMMAND_MESH,
+        .pass = (unsigned char)pass,
+        .state = state,
+        .mesh = mesh,
+        .material = material,
+        .textureId = textureId,
+        .instanceCount = 1
+    };
+    CopyCommand(list, command, &instance);
+}
+
+void RecordInstancesCommand(RenderCommandList* list, RenderPass pass, const Mesh* mesh, unsigned int textureId,
+                            const InstanceData* instances, int count, unsigned char state)
+{
+    if (!list || !mesh || count <= 0) return;
+
+    // Oversized runs are split so each piece fits the pool
+    while (count > 0)
+    {
+        int chunk = count > RENDER_INSTANCE_CAPACITY ? RENDER_INSTANCE_CAPACITY : count;
+        RenderCommand command = {
+            .type = RENDER_COMMAND_INSTANCES,
+            .pass = (unsigned char)pass,
+            .state = state,
+            .mesh = mesh,
+            .material = NULL,
+            .textureId = textureId,
+            .instanceCount = chunk
+        };
+        CopyCommand(list, command, instances);
+
+        instances += chunk;
+        count -= chunk;
+    }
+}
+
+void PushMeshCommand(RenderPass pass, const Mesh* mesh, const Material* material, unsigned int textureId,
+                     Color color, Matrix transform, unsigned char state)
+{
+    RecordMeshCommand(&frameList, pass, mesh, material, textureId, color, transform, state);
+}
+
+void PushInstancesCommand(RenderPass pass, const Mesh* mesh, unsigned int textureId,
+                          const InstanceData* instances, int count, unsigned char state)
+{
+    RecordInstancesCommand(&frameList, pass, mesh, textureId, instances, count, state);
+}
+
+RenderCommandRange GetCommandRange(const RenderCommandList* list, int firstCommand)
+{
+    return (RenderCommandRange){ firstCommand, list->commandCount - firstCommand };
+}
+
+void SubmitCommandList(const RenderCommandList* list, RenderCommandRange range)
+{
+    for (int i = range.first; i < range.first + range.count; i++)
+    {
+        const RenderCommand* command = &list->commands[i];
+        CopyCommand(&frameList, *command, &list->instances[command->firstInstance]);
+    }
+
+    SubmitRenderCommands();
+}
+
+const RenderCommand* GetRenderCommands(int* count)
+{
+    if (count) *count = frameList.commandCount;
+    return frameList.commands;
+}
+
+size_t GetRenderCommandsSize()
+{
+    return sizeof(RenderCommandHeader) + (size_t)frameList.commandCount * sizeof(RenderCommandRecord) +
+           (size_t)frameList.instanceCount * sizeof(InstanceData);
+}
+
+size_t SerializeRenderCommands(void* buffer, size_t capacity)
+{
+    size_t size = GetRenderCommandsSize();
+    if (!buffer || capacity < size)
+    {
+        printf("Warning: Render command list needs %zu bytes, buffer has %zu\n", size, capacity);
+        return 0;
+    }
+
+    RenderCommandHeader* header = (RenderCommandHeader*)buffer;
+    header->magic = RENDER_COMMANDS_MAGIC;
+    header->version = RENDER_COMMANDS_VERSION;
+    header->size = (unsigned int)size;
+    header->commandCount = frameList.commandCount;
+    header->instanceCount = frameList.instanceCount;
+
+    RenderCommandRecord* record = (RenderCommandRecord*)(header + 1);
+    for (int i = 0; i < frameList.commandCount; i++, record++)
+    {
+        const RenderCommand* command = &frameList.commands[i];
+
+        memset(record, 0, sizeof(RenderCommandRecord));
+        record->type = command->type;
+        record->pass = command->pass;
+        record->state = command->state;
+        record->vaoId = command->mesh->vaoId;
+        record->vertexCount = command->mesh->vertexCount;
+        record->triangleCount = command->mesh->triangleCount;
+        record->shaderId = command->material ? command->material->shader.id : 0;
+        record->textureId = command->textureId;
+        record->firstInstance = command->firstInstance;
+        record->instanceCount = command->instanceCount;
+    }
+
+    memcpy(record, frameList.instances, (size_t)frameList.instanceCount * sizeof(InstanceData));
+    return size;
+}
+
+static const Mesh* GetReplayMesh(const RenderCommandRecord* record, int* meshCount)
+{
+    for (int i = 0; i < *meshCount; i++)
+    {
+        const Mesh* mesh = &replayMeshes[i];
+        if (mesh->vaoId == record->vaoId && mesh->vertexCount == record->vertexCount &&
+            mesh->triangleCount == record->triangleCount)
+        {
+            return mesh;
+        }
+    }
+
+    Mesh* mesh = &replayMeshes[(*meshCount)++];
+    *mesh = (Mesh){0};
+    mesh->vaoId = record->vaoId;
+    mesh->vertexCount = record->vertexCount;
+    mesh->triangleCount = record->triangleCount;
+    return mesh;
+}
+
+static const Material* GetReplayMaterial(unsigned int shaderId, int* materialCount)
+{
+    for (int i = 0; i < *materialCount; i++)
+    {
+        if (replayMaterials[i].shader.id == shaderId) return &replayMaterials[i];
+    }
+
+    Material* material = &replayMaterials[(*materialCount)++];
+    *material = (Material){0};
+    material->shader.id = shaderId;
+    return material;
+}
+
+bool ReplayRenderCommands(const void* buffer, size_t size)
+{
+    if (commandStats.backend != RENDER_BACKEND_NULL)
+    {
+        printf("Warning: Render commands can only be replayed on the null backend\n");
+        return false;
+    }
+
+    const RenderCommandHeader* header = (const RenderCommandHeader*)buffer;
+    if (!buffer || size < sizeof(RenderCommandHeader) || header->magic != RENDER_COMMANDS_MAGIC)
+    {
+        printf("Warning: Invalid render command list\n");
+        return false;
+    }
+
+    if (header->version != RENDER_COMMANDS_VERSION)
+    {
+        printf("Warning: Unsupported render command list version %u\n", header->version);
+        return false;
+    }
+
+    if (header->commandCount < 0 || header->commandCount > MAX_RENDER_COMMANDS ||
+        header->instanceCount < 0 || header->instanceCount > RENDER_INSTANCE_CAPACITY ||
+        header->size != sizeof(RenderCommandHeader) + (size_t)header->commandCount * sizeof(RenderCommandRecord) +
+                        (size_t)header->instanceCount * sizeof(InstanceData) ||
+        header->size > size)
+    {
+        printf("Warning: Corrupt render command list\n");
+        return false;
+    }
+
+    const RenderCommandRecord* records = (const RenderCommandRecord*)(header + 1);
+    for (int i = 0; i < header->commandCount; i++)
+    {
+        const RenderCommandRecord* record = &records[i];
+        if (record->type > RENDER_COMMAND_INSTANCES || record->firstInstance < 0 || record->instanceCount <= 0 ||
+            record->firstInstance + record->instanceCount > header->instanceCount)
+        {
+            printf("Warning: Corrupt render command list\n");
+            return false;
+        }
+    }
+
+    ResetRenderCommands();
+    memcpy(frameList.instances, records + header->commandCount, (size_t)header->instanceCount * sizeof(InstanceData));
+    frameList.instanceCount = header->instanceCount;
+
+    int meshCount = 0;
+    int materialCount = 0;
+    for (int i = 0; i < header->commandCount; i++)
+    {
+        const RenderCommandRecord* record = &records[i];
+        RenderCommand command = {
+            .type = record->type,
+            .pass = record->pass,
+            .state = record->state,
+            .mesh = GetReplayMesh(record, &meshCount),
+            .material = (record->type == RENDER_COMMAND_MESH) ? GetReplayMaterial(record->shaderId, &materialCount) : NULL,
+            .textureId = record->textureId,
+            .firstInstance = record->firstInstance,
+            .instanceCount = record->instanceCount
+        };
+        AddCommand(&frameList, command);
+    }
+
+    SubmitRenderCommands();
+    return true;
+}
+
+void SetRenderBackend(RenderBackend backend)
+{
+    commandStats.backend = backend;
+    printf("Render backend: %s\n", backend == RENDER_BACKEND_NULL ? "null" : "raylib");
+}
+
+RenderBackend GetRenderBackend()
+{
+    return commandStats.backend;
+}
+
+RenderCommandStats* GetRenderCommandStats()
+{
+    return &commandStats;
+}
@@ -0,0 +1,143 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Render Command List Module
+//==================================================================
+
+#ifndef COMMAND_LIST_H
+#define COMMAND_LIST_H
+
+#include "raylib.h"
+#include "render.h"
+#include "instancing.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#define MAX_RENDER_COMMANDS 1024
+#define RENDER_INSTANCE_CAPACITY 16384
+
+#define RENDER_COMMANDS_MAGIC 0x43525751u
+#define RENDER_COMMANDS_VERSION 2
+
+// Per-command state flags, restored after the command executes
+#define RENDER_STATE_NO_DEPTH_WRITE 0x01
+#define RENDER_STATE_NO_CULLING     0x02
+
+typedef enum
+{
+    RENDER_BACKEND_RAYLIB,
+    RENDER_BACKEND_NULL         // counts and records, never touches GL
+} RenderBackend;
+
+typedef enum
+{
+    RENDER_COMMAND_MESH,        // DrawMesh with a material, one transform
+    RENDER_COMMAND_INSTANCES    // DrawInstances with the instancing shader
+} RenderCommandType;
+
+typedef struct
+{
+    unsigned char type;
+    unsigned char pass;
+    unsigned char state;
+    const Mesh* mesh;
+    const Material* material;
+    unsigned int textureId;
+    int firstInstance;
+    int instanceCount;
+} RenderCommand;
+
+// A frame's commands recorded away from GL, e.g. on the render worker.
+// Mesh and material pointers must outlive the list's submission.
+typedef struct
+{
+    RenderCommand commands[MAX_RENDER_COMMANDS];
+    InstanceData instances[RENDER_INSTANCE_CAPACITY];
+    int commandCount;
+    int instanceCount;
+    int overflows;              // commands dropped because the list was full
+} RenderCommandList;
+
+typedef struct
+{
+    int first;
+    int count;
+} RenderCommandRange;
+
+typedef struct
+{
+    RenderBackend backend;
+    int commands;
+    int instances;
+    int triangles;
+    int stateChanges;
+    int submits;
+    int overflows;
+} RenderCommandStats;
+
+typedef struct
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned int size;
+    int commandCount;
+    int instanceCount;
+} RenderCommandHeader;
+
+typedef struct
+{
+    unsigned char type;
+    unsigned char pass;
+    unsigned char state;
+    unsigned char reserved;
+    unsigned int vaoId;
+    int vertexCount;
+    int triangleCount;
+    unsigned int shaderId;      // 0 for RENDER_COMMAND_INSTANCES
+    unsigned int textureId;
+    int firstInstance;
+    int instanceCount;
+} RenderCommandRecord;
+
+// Drawing code pushes commands and then submits them to the active
+// backend at the end of its pass, while the pass's render target and
+// matrices are still bound. Mesh and material pointers must stay valid
+// until then; transforms and instance data are copied. The list keeps
+// the whole frame until ResetRenderCommands, so it can be serialized.
+void ResetRenderCommands();
+void PushMeshCommand(RenderPass pass, const Mesh* mesh, const Material* material, unsigned int textureId,
+                     Color color, Matrix transform, unsigned char state);
+void PushInstancesCommand(RenderPass pass, const Mesh* mesh, unsigned int textureId,
+                          const InstanceData* instances, int count, unsigned char state);
+void SubmitRenderCommands();
+
+// Recording touches no GL and no shared state, so any thread may fill
+// its own list. A full list drops further commands instead of flushing.
+void ClearCommandList(RenderCommandList* list);
+void RecordMeshCommand(RenderCommandList* list, RenderPass pass, const Mesh* mesh, const Material* material,
+                       unsigned int textureId, Color color, Matrix transform, unsigned char state);
+void RecordInstancesCommand(RenderCommandList* list, RenderPass pass, const Mesh* mesh, unsigned int textureId,
+                            const InstanceData* instances, int count, unsigned char state);
+RenderCommandRange GetCommandRange(const RenderCommandList* list, int firstCommand);
+
+// Main thread: appends the range to the frame's list and submits it
+void SubmitCommandList(const RenderCommandList* list, RenderCommandRange range);
+
+const RenderCommand* GetRenderCommands(int* count);
+
+// Header, then one RenderCommandRecord per command, then every instance
+size_t GetRenderCommandsSize();
+size_t SerializeRenderCommands(void* buffer, size_t capacity);
+
+// Loads a serialized list as the current frame and submits it. Meshes and
+// materials come back as stand-ins holding only the recorded ids and
+// counts, so this runs on the null backend only: a captured frame can be
+// counted and benchmarked with no window or GL context.
+bool ReplayRenderCommands(const void* buffer, size_t size);
+
+void SetRenderBackend(RenderBackend backend);
+RenderBackend GetRenderBackend();
+RenderCommandStats* GetRenderCommandStats();
+
+#endif
@@ -0,0 +1,235 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Frustum Culling Implementation
+//==================================================================
+
+#include "culling.h"
+#include "engine.h"
+#include "occlusion.h"
+#include <math.h>
+#include <stdlib.h>
+
+typedef struct
+{
+    Vector3 normal;
+    float distance;
+} FrustumPlane;
+
+static FrustumPlane frustum[6];
+static bool cullingEnabled = true;
+static CullingStats cullingStats = {0};
+
+static Vector3 objectCenters[MAX_OBJECTS];
+static float objectRadii[MAX_OBJECTS];
+static bool objectInView[MAX_OBJECTS];
+static bool objectOccluder[MAX_OBJECTS];
+static int culledObjectCount = 0;
+
+static Vector3 cullEye = {0};
+static float fogCullDistance = -1.0f;
+
+typedef struct
+{
+    int object;
+    float score;
+} OccluderCandidate;
+
+static OccluderCandidate occluderCandidates[MAX_OBJECTS];
+
+static void SetPlane(FrustumPlane* plane, float a, float b, float c, float d)
+{
+    float length = sqrtf(a*a + b*b + c*c);
+    if (length <= 0.0f) length = 1.0f;
+
+    plane->normal = (Vector3){a / length, b / length, c / length};
+    plane->distance = d / length;
+}
+
+static void ExtractFrustum(Matrix viewProjection)
+{
+    float m[16];
+    MatrixToFloats(viewProjection, m);
+
+    // Gribb/Hartmann: clip row r is (m[r], m[4+r], m[8+r], m[12+r])
+    SetPlane(&frustum[0], m[3] + m[0], m[7] + m[4], m[11] + m[8],  m[15] + m[12]);
+    SetPlane(&frustum[1], m[3] - m[0], m[7] - m[4], m[11] - m[8],  m[15] - m[12]);
+    SetPlane(&frustum[2], m[3] + m[1], m[7] + m[5], m[11] + m[9],  m[15] + m[13]);
+    SetPlane(&frustum[3], m[3] - m[1], m[7] - m[5], m[11] - m[9],  m[15] - m[13]);
+    SetPlane(&frustum[4], m[3] + m[2], m[7] + m[6], m[11] + m[10], m[15] + m[14]);
+    SetPlane(&frustum[5], m[3] - m[2], m[7] - m[6], m[11] - m[10], m[15] - m[14]);
+}
+
+static bool SphereInFrustum(Vector3 center, float radius)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        float d = frustum[i].normal.x * center.x + frustum[i].normal.y * center.y +
+                  frustum[i].normal.z * center.z + frustum[i].distance;
+        if (d < -radius) return false;
+    }
+    return true;
+}
+
+void GetObjectBounds(const GameObject* obj, Vector3* center, float* radius)
+{
+    Vector3 position, scale;
+    MeshPrimitive primitive = GetObjectPrimitive(obj, &position, &scale);
+
+    *center = position;
+    if (primitive == MESH_CYLINDER || primitive == MESH_CONE)
+    {
+        // Drawn upward from the base like DrawCylinder
+        center->y += scale.y * 0.5f;
+    }
+
+    *radius = 0.5f * sqrtf(scale.x*scale.x + scale.y*scale.y + scale.z*scale.z);
+}
+
+static int CompareOccluders(const void* a, const void* b)
+{
+    float sa = ((const OccluderCandidate*)a)->score;
+    float sb = ((const OccluderCandidate*)b)->score;
+    return (sa < sb) - (sa > sb);
+}
+
+// Big, close, opaque static boxes make the best occluders
+static void BuildOcclusion(GameObject** objects, int objectCount, Matrix viewProjection)
+{
+    int candidates = 0;
+
+    BeginOcclusionFrame(viewProjection);
+    if (!GetOcclusionStats()->enabled) return;
+
+    for (int i = 0; i < objectCount; i++)
+    {
+        GameObject* obj = objects[i];
+        if (!objectInView[i] || !obj->isStatic || obj->type != OBJ_CUBE) continue;
+
+        unsigned int textureId;
+        if (GetObjectDrawColor(obj, &textureId).a < 255) continue;
+
+        Vector3 half = Vector3Scale(obj->size, 0.5f);
+        Vector3 offset = Vector3Subtract(cullEye, obj->position);
+        if (fabsf(offset.x) <= half.x + 0.1f && fabsf(offset.y) <= half.y + 0.1f &&
+            fabsf(offset.z) <= half.z + 0.1f) continue;
+
+        float distance = Vector3Length(offset);
+        float score = objectRadii[i] / (distance > 0.01f ? distance : 0.01f);
+        if (score < OCCLUDER_MIN_SCORE) continue;
+
+        occluderCandidates[candidates++] = (OccluderCandidate){ i, score };
+    }
+
+    if (candidates > MAX_OCCLUDERS)
+    {
+        qsort(occluderCandidates, candidates, sizeof(OccluderCandidate), CompareOccluders);
+        candidates = MAX_OCCLUDERS;
+    }
+
+    for (int c = 0; c < candidates; c++)
+    {
+        GameObject* obj = objects[occluderCandidates[c].object];
+        Vector3 half = Vector3Scale(obj->size, 0.5f);
+
+        RasterizeOccluderBox(Vector3Subtract(obj->position, half), Vector3Add(obj->position, half));
+        objectOccluder[occluderCandidates[c].object] = true;
+    }
+
+    FinishOcclusionFrame();
+}
+
+static bool IsSphereOccluded(Vector3 center, float radius)
+{
+    Vector3 extent = {radius, radius, radius};
+    return IsBoxOccluded(Vector3Subtract(center, extent), Vector3Add(center, extent));
+}
+
+void UpdateCulling(const RenderView* view, GameObject** objects, int objectCount)
+{
+    Matrix viewProjection = view->viewProjection;
+
+    cullingStats = (CullingStats){0};
+    ExtractFrustum(viewProjection);
+    cullEye = view->camera.position;
+    fogCullDistance = view->fogCullDistance;
+
+    for (int i = 0; i < objectCount; i++)
+    {
+        objectInView[i] = false;
+        objectOccluder[i] = false;
+        if (!objects[i] || !objects[i]->isActive || !objects[i]->isVisible ||
+            objects[i]->type == OBJ_PLAYER) continue;
+
+        GetObjectBounds(objects[i], &objectCenters[i], &objectRadii[i]);
+        objectInView[i] = IsSphereInView(objectCenters[i], objectRadii[i], CULL_OBJECTS);
+    }
+    culledObjectCount = objectCount;
+
+    if (!cullingEnabled) return;
+
+    // Occluders are chosen among the frustum survivors
+    BuildOcclusion(objects, objectCount, viewProjection);
+
+    for (int i = 0; i < objectCount; i++)
+    {
+        if (!objectInView[i] || objectOccluder[i]) continue;
+
+        if (IsSphereOccluded(objectCenters[i], objectRadii[i]))
+        {
+            objectInView[i] = false;
+            cullingStats.visible[CULL_OBJECTS]--;
+            cullingStats.occluded[CULL_OBJECTS]++;
+        }
+    }
+}
+
+bool IsObjectInView(int objectIndex)
+{
+    if (objectIndex < 0 || objectIndex >= culledObjectCount) return true;
+    return objectInView[objectIndex];
+}
+
+bool IsSphereInView(Vector3 center, float radius, CullCategory category)
+{
+    cullingStats.tested[category]++;
+
+    bool visible = !cullingEnabled || SphereInFrustum(center, radius);
+
+    // Opaque geometry is fog-colored past this point, nothing left to see
+    if (visible && cullingEnabled && fogCullDistance >= 0.0f &&
+        (category == CULL_OBJECTS || category == CULL_STATIC) &&
+        Vector3Length(Vector3Subtract(center, cullEye)) - radius > fogCullDistance)
+    {
+        cullingStats.fogCulled++;
+        visible = false;
+    }
+
+    // Static cells hold the occluders themselves, so they skip this
+    if (visible && cullingEnabled && category != CULL_STATIC && category != CULL_OBJECTS &&
+        IsOcclusionReady() && IsSphereOccluded(center, radius))
+    {
+        cullingStats.occluded[category]++;
+        visible = false;
+    }
+
+    if (visible) cullingStats.visible[category]++;
+    return visible;
+}
+
+void SetCullingEnabled(bool enabled)
+{
+    cullingEnabled = enabled;
+    printf("Frustum culling %s\n", enabled ? "enabled" : "disabled");
+}
+
+bool GetCullingEnabled()
+{
+    return cullingEnabled;
+}
+
+CullingStats* GetCullingStats()
+{
+    return &cullingStats;
+}
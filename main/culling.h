@@ -0,0 +1,52 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Frustum Culling Module
+//==================================================================
+
+#ifndef CULLING_H
+#define CULLING_H
+
+#include "raylib.h"
+#include "objects.h"
+#include "render.h"
+#include <stdbool.h>
+
+#define OCCLUDER_MIN_SCORE 0.05f   // bounding radius / distance
+
+typedef enum
+{
+    CULL_OBJECTS,
+    CULL_SHADOWS,
+    CULL_PARTICLES,
+    CULL_STATIC,
+    CULL_CATEGORY_COUNT
+} CullCategory;
+
+typedef struct
+{
+    int tested[CULL_CATEGORY_COUNT];
+    int visible[CULL_CATEGORY_COUNT];
+    int occluded[CULL_CATEGORY_COUNT];
+    int fogCulled;
+} CullingStats;
+
+// Extracts the frustum of a recorded frame's view and computes every
+// object's bounding sphere and visibility. Later passes recording the
+// same frame reuse the result. Objects and static batches lying entirely
+// past the view's fog cull distance are culled too, and large static
+// cubes are rasterized as occluders for objects, shadows and particles
+// hidden behind them. Runs wherever the frame records, so the state
+// below belongs to that thread until the frame is finished.
+void UpdateCulling(const RenderView* view, GameObject** objects, int objectCount);
+
+bool IsObjectInView(int objectIndex);
+bool IsSphereInView(Vector3 center, float radius, CullCategory category);
+void GetObjectBounds(const GameObject* obj, Vector3* center, float* radius);
+
+void SetCullingEnabled(bool enabled);
+bool GetCullingEnabled();
+CullingStats* GetCullingStats();
+
+#endif
@@ -0,0 +1,179 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Debug Draw Implementation
+//==================================================================
+
+#include "debug_draw.h"
+#include "command_list.h"
+#include "rlgl.h"
+#include <math.h>
+
+typedef struct
+{
+    Vector3 position;
+    Color color;
+} DebugVertex;
+
+static DebugVertex lineVertices[DEBUG_LINE_CAPACITY * 2];
+static int lineCount = 0;
+
+static rlRenderBatch lineBatch;
+static bool lineBatchReady = false;
+
+static bool categoryEnabled[DEBUG_DRAW_CATEGORY_COUNT] = { true, false, false };
+static DebugDrawStats debugStats = {0};
+
+void DebugLine(Vector3 start, Vector3 end, Color color)
+{
+    if (lineCount >= DEBUG_LINE_CAPACITY)
+    {
+        debugStats.dropped++;
+        return;
+    }
+
+    lineVertices[lineCount * 2] = (DebugVertex){ start, color };
+    lineVertices[lineCount * 2 + 1] = (DebugVertex){ end, color };
+    lineCount++;
+}
+
+void DebugBox(Vector3 center, Vector3 size, Color color)
+{
+    float x = size.x * 0.5f, y = size.y * 0.5f, z = size.z * 0.5f;
+    Vector3 c[8];
+
+    for (int i = 0; i < 8; i++)
+    {
+        c[i] = (Vector3){ center.x + ((i & 1) ? x : -x), center.y + ((i & 2) ? y : -y), center.z + ((i & 4) ? z : -z) };
+    }
+
+    // Corners differing in one bit share an edge
+    for (int i = 0; i < 8; i++)
+    {
+        for (int bit = 1; bit < 8; bit <<= 1)
+        {
+            if (!(i & bit)) DebugLine(c[i], c[i | bit], color);
+        }
+    }
+}
+
+// Latitude rings and meridians, as DrawSphereWires lays them out
+void DebugSphere(Vector3 center, float radius, int segments, Color color)
+{
+    if (segments < 3) segments = 3;
+
+    for (int ring = 0; ring <= segments; ring++)
+    {
+        float lat0 = PI * ((float)ring / (segments + 1) - 0.5f);
+        float lat1 = PI * ((float)(ring + 1) / (segments + 1) - 0.5f);
+
+        for (int slice = 0; slice < segments; slice++)
+        {
+            float lon0 = 2.0f * PI * slice / segments;
+            float lon1 = 2.0f * PI * (slice + 1) / segments;
+            Vector3 a = { center.x + radius * cosf(lat0) * sinf(lon0), center.y + radius * sinf(lat0), center.z + radius * cosf(lat0) * cosf(lon0) };
+            Vector3 b = { center.x + radius * cosf(lat1) * sinf(lon0), center.y + radius * sinf(lat1), center.z + radius * cosf(lat1) * cosf(lon0) };
+            Vector3 c = { center.x + radius * cosf(lat0) * sinf(lon1), center.y + radius * sinf(lat0), center.z + radius * cosf(lat0) * cosf(lon1) };
+
+            DebugLine(a, b, color);
+            if (ring > 0) DebugLine(a, c, color);
+        }
+    }
+}
+
+// Position is the base center, as in DrawCylinderWires
+void DebugCylinder(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color)
+{
+    if (slices < 3) slices = 3;
+
+    for (int i = 0; i < slices; i++)
+    {
+        float a0 = 2.0f * PI * i / slices;
+        float a1 = 2.0f * PI * (i + 1) / slices;
+        Vector3 bottom0 = { position.x + sinf(a0) * radiusBottom, position.y, position.z + cosf(a0) * radiusBottom };
+        Vector3 bottom1 = { position.x + sinf(a1) * radiusBottom, position.y, position.z + cosf(a1) * radiusBottom };
+        Vector3 top0 = { position.x + sinf(a0) * radiusTop, position.y + height, position.z + cosf(a0) * radiusTop };
+        Vector3 top1 = { position.x + sinf(a1) * radiusTop, position.y + height, position.z + cosf(a1) * radiusTop };
+
+        DebugLine(bottom0, bottom1, color);
+        DebugLine(top0, top1, color);
+        DebugLine(bottom0, top0, color);
+    }
+}
+
+// Same layout and shades as DrawGrid
+void DebugGrid(int slices, float spacing)
+{
+    int halfSlices = slices / 2;
+    float extent = halfSlices * spacing;
+
+    for (int i = -halfSlices; i <= halfSlices; i++)
+    {
+        Color color = (i == 0) ? (Color){ 128, 128, 128, 255 } : (Color){ 191, 191, 191, 255 };
+        float offset = i * spacing;
+
+        DebugLine((Vector3){ offset, 0.0f, -extent }, (Vector3){ offset, 0.0f, extent }, color);
+        DebugLine((Vector3){ -extent, 0.0f, offset }, (Vector3){ extent, 0.0f, offset }, color);
+    }
+}
+
+bool FlushDebugDraw()
+{
+    int count = lineCount;
+
+    debugStats.lines = count;
+    lineCount = 0;
+    if (count == 0 || GetRenderBackend() == RENDER_BACKEND_NULL) return false;
+
+    // Sized so the whole queue fits one draw; GL 1.1 has no custom batches
+    // and shares raylib's instead
+    if (!lineBatchReady && rlGetVersion() != RL_OPENGL_11)
+    {
+        lineBatch = rlLoadRenderBatch(1, DEBUG_LINE_CAPACITY / 2 + 1);
+        lineBatchReady = true;
+    }
+
+    // Switching batches draws whatever raylib had queued first
+    if (lineBatchReady) rlSetRenderBatchActive(&lineBatch);
+
+    rlBegin(RL_LINES);
+    for (int i = 0; i < count * 2; i++)
+    {
+        const DebugVertex* v = &lineVertices[i];
+        rlColor4ub(v->color.r, v->color.g, v->color.b, v->color.a);
+        rlVertex3f(v->position.x, v->position.y, v->position.z);
+    }
+    rlEnd();
+
+    if (lineBatchReady) rlSetRenderBatchActive(NULL);
+
+    debugStats.flushes++;
+    return true;
+}
+
+void CloseDebugDraw()
+{
+    if (lineBatchReady) rlUnloadRenderBatch(lineBatch);
+
+    lineBatchReady = false;
+    lineCount = 0;
+}
+
+void SetDebugDrawCategory(DebugDrawCategory category, bool enabled)
+{
+    if ((unsigned int)category >= DEBUG_DRAW_CATEGORY_COUNT) return;
+    categoryEnabled[category] = enabled;
+}
+
+#if QWEE_DEBUG_DRAW
+bool IsDebugDrawCategoryEnabled(DebugDrawCategory category)
+{
+    return (unsigned int)category < DEBUG_DRAW_CATEGORY_COUNT && categoryEnabled[category];
+}
+#endif
+
+DebugDrawStats* GetDebugDrawStats()
+{
+    return &debugStats;
+}
@@ -0,0 +1,61 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Debug Draw Module
+//==================================================================
+
+#ifndef DEBUG_DRAW_H
+#define DEBUG_DRAW_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+// Release builds (-DNDEBUG) drop the debug categories; define
+// QWEE_DEBUG_DRAW to override
+#ifndef QWEE_DEBUG_DRAW
+    #ifdef NDEBUG
+        #define QWEE_DEBUG_DRAW 0
+    #else
+        #define QWEE_DEBUG_DRAW 1
+    #endif
+#endif
+
+#define DEBUG_LINE_CAPACITY 16384     // lines per flush, extras are dropped
+
+typedef enum
+{
+    DEBUG_DRAW_COLLIDERS,
+    DEBUG_DRAW_BOUNDS,
+    DEBUG_DRAW_CONTACTS,
+    DEBUG_DRAW_CATEGORY_COUNT
+} DebugDrawCategory;
+
+typedef struct
+{
+    int lines;                      // in the last flush
+    int dropped;
+    int flushes;
+} DebugDrawStats;
+
+// Lines queue on the CPU and go out in one draw from a dedicated rlgl
+// batch when SubmitRenderObjects calls FlushDebugDraw, depth tested against the
+// scene. Wireframe mode and the grid use them in every build.
+void DebugLine(Vector3 start, Vector3 end, Color color);
+void DebugBox(Vector3 center, Vector3 size, Color color);
+void DebugSphere(Vector3 center, float radius, int segments, Color color);
+void DebugCylinder(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color);
+void DebugGrid(int slices, float spacing);
+bool FlushDebugDraw();
+void CloseDebugDraw();
+
+void SetDebugDrawCategory(DebugDrawCategory category, bool enabled);
+#if QWEE_DEBUG_DRAW
+bool IsDebugDrawCategoryEnabled(DebugDrawCategory category);
+#else
+#define IsDebugDrawCategoryEnabled(category) false
+#endif
+
+DebugDrawStats* GetDebugDrawStats();
+
+#endif
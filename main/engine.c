@@ -104,6 +104,7 @@ void InitEngine(int screenWidth, int screenHeight, const char* title, bool fulls
     InitParticleSystem();
     InitFog();
     InitShadows(screenWidth, screenHeight);
+    InitRender();
     InitAudioSystem();
     InitSceneSystem();
 
@@ -151,6 +152,9 @@ void CloseEngine()
     printf("========================================\n");
     printf("Shutting down QWEE Engine...\n");
 
+    StopPhysicsThread();
+    CloseRenderPipeline();
+
     printf("Cleaning up scenes...\n");
     Scene* current = GetCurrentScene();
     if (current)
@@ -175,6 +179,18 @@ void CloseEngine()
     
     printf("Cleaning up audio...\n");
     CloseAudioSystem();
+    
+    CloseOverlay();
+    CloseDynamicResolution();
+    CloseFog();
+    CloseRender();
+    CloseMeshCache();
+    CloseTextureAtlas();
+    CloseDebugDraw();
+    CloseLights();
+    CloseImpostors();
+    CloseGpuTimers();
+    CloseSpriteBatch();
 
     CloseWindow();
     
@@ -185,12 +201,22 @@ void CloseEngine()
 void UpdateEngine(float deltaTime)
 {
     UpdateDeltaTime();
+    ResetRenderCommands();
+    BeginGpuTimerFrame();
 
     if (Engine_IsCurrentScene3D())
     {
         UpdateCameraSystem();
-        UpdatePhysics(deltaTime);
-        UpdatePlayerPhysics(deltaTime);
+        
+        if (IsPhysicsThreadRunning())
+        {
+            SyncPhysicsThread();
+        }
+        else
+        {
+            UpdatePhysics(deltaTime);
+            UpdatePlayerPhysics(deltaTime);
+        }
     }
     
     if (particlesEnabled)
@@ -198,9 +224,11 @@ void UpdateEngine(float deltaTime)
         UpdateParticles(deltaTime);
     }
 
-    if (shadowsEnabled && Engine_IsCurrentScene3D())
+    UpdateLights(deltaTime);
+
+    if (Engine_IsCurrentScene3D())
     {
-        UpdateShadows();
+        UpdateImpostors();
     }
     
     if (audioEnabled)
@@ -219,13 +247,30 @@ void RenderAll()
     
     if (scene && scene->type == SCENE_2D)
     {
+        FlushRenderPipeline();
         ClearBackground(RAYWHITE);
         RenderCurrentScene();
+
+        BeginGpuPass(GPU_PASS_SPRITES);
+        FlushSprites();
+        EndGpuPass(GPU_PASS_SPRITES);
     }
     else
     {
+        // Submits an older frame while the worker records this one
+        const PipelineFrame* frame = AdvanceRenderPipeline();
+
+        if (frame->shadows)
+        {
+            BeginGpuPass(GPU_PASS_SHADOWS);
+            SubmitShadowPass(frame);
+            EndGpuPass(GPU_PASS_SHADOWS);
+        }
+
+        BeginScaledRender();
+
         FogSettings* fog = GetFogSettings();
-        if (fogEnabled && fog->enabled && fog->skyAffected)
+        if (frame->fog && fog->skyAffected)
         {
             Color skyColor = (Color){135, 206, 235, 255};
             Color finalSkyColor = {
@@ -241,132 +286,129 @@ void RenderAll()
             ClearBackground((Color){135, 206, 235, 255});
         }
         
-        BeginMode3D(camera);
+        BeginMode3D(frame->view.camera);
 
-        if (fogEnabled)
-        {
-            ApplyFog();
-        }
+        ApplyFog();
 
-        for (int i = 0; i < objectCount; i++)
+        // Lines queued before SubmitRenderObjects go out with its debug draw flush
+        if (!frame->fog)
         {
-            if (objects[i] && objects[i]->isActive)
-            {
-                DrawObject(objects[i]);
-            }
+            DebugGrid(50, 1.0f);
         }
-        
-        if (fogEnabled && fog->enabled)
-        {
-            for (int i = -25; i <= 25; i++)
-            {
-                for (int j = -25; j <= 25; j++)
-                {
-                    Vector3 lineStart1 = {i, 0.01f, -25};
-                    Vector3 lineEnd1 = {i, 0.01f, 25};
-                    Vector3 lineStart2 = {-25, 0.01f, j};
-                    Vector3 lineEnd2 = {25, 0.01f, j};
-
-                    float dist1 = Vector3Length(Vector3Subtract(camera.position, lineStart1));
-                    float dist2 = Vector3Length(Vector3Subtract(camera.position, lineStart2));
-
-                    Color gridColor = LIGHTGRAY;
-                    if (fogEnabled && fog->enabled)
-                    {
-                        float fogFactor1 = 1.0f;
-                        float fogFactor2 = 1.0f;
-                        
-                        if (fog->type == FOG_LINEAR)
-                        {
-                            fogFactor1 = (fog->endDistance - dist1) / (fog->endDistance - fog->startDistance);
-                            fogFactor2 = (fog->endDistance - dist2) / (fog->endDistance - fog->startDistance);
-                        }
-                        else if (fog->type == FOG_EXPONENTIAL)
-                        {
-                            fogFactor1 = expf(-fog->density * dist1);
-                            fogFactor2 = expf(-fog->density * dist2);
-                        }
-                        else if (fog->type == FOG_EXPONENTIAL_SQUARED)
-                        {
-                            fogFactor1 = expf(-powf(fog->density * dist1, 2));
-                            fogFactor2 = expf(-powf(fog->density * dist2, 2));
-                        }
-                        
-                        fogFactor1 = (fogFactor1 < 0) ? 0 : (fogFactor1 > 1) ? 1 : fogFactor1;
-                        fogFactor2 = (fogFactor2 < 0) ? 0 : (fogFactor2 > 1) ? 1 : fogFactor2;
-                        
-                        gridColor.a = (unsigned char)(200 * fogFactor1);
-                    }
-
-                    if (gridColor.a > 10)
-                    {
-                        DrawLine3D(lineStart1, lineEnd1, gridColor);
-                        DrawLine3D(lineStart2, lineEnd2, gridColor);
-                    }
-                }
-            }
-        }
-        else
+
+        if (frame->player >= 0 && frame->wireframe && Engine_IsCurrentScene3D())
         {
-            DrawGrid(50, 1.0f);
+            const GameObject* player = &frame->objects[frame->player];
+            Vector3 playerCenter = player->position;
+            playerCenter.y += player->size.y/2 - player->size.x/2;
+            DebugSphere(playerCenter, player->size.x/2, 8, GREEN);
         }
 
-        if (shadowsEnabled)
+        SubmitRenderObjects(frame);
+        
+        if (frame->fog)
         {
-            RenderShadows();
+            BeginGpuPass(GPU_PASS_GRID);
+            DrawFogGrid(frame->view.camera);
+            EndGpuPass(GPU_PASS_GRID);
         }
 
-        if (particlesEnabled)
+        if (frame->shadows)
         {
-            RenderParticles();
+            BeginGpuPass(GPU_PASS_SHADOWS);
+            SubmitBlobShadows(frame);
+            EndGpuPass(GPU_PASS_SHADOWS);
         }
 
-        if (playerObject && wireframeMode && Engine_IsCurrentScene3D())
+        if (frame->particles)
         {
-            Vector3 playerCenter = playerObject->position;
-            playerCenter.y += playerObject->size.y/2 - playerObject->size.x/2;
-            DrawSphereWires(playerCenter, playerObject->size.x/2, 8, 8, GREEN);
+            BeginGpuPass(GPU_PASS_PARTICLES);
+            SubmitCommandList(&frame->commands, frame->particleCommands);
+            EndGpuPass(GPU_PASS_PARTICLES);
         }
         
         EndMode3D();
+        EndScaledRender();
+        FinishRenderPipeline();
 
         RenderCurrentScene();
+
+        BeginGpuPass(GPU_PASS_SPRITES);
+        FlushSprites();
+        EndGpuPass(GPU_PASS_SPRITES);
     }
 
-    DrawFPS(10, 10);
+    BeginGpuPass(GPU_PASS_OVERLAY);
+    BeginOverlay();
+    OverlayFPS("hud.fps", 10, 10);
 
     int yPos = 40;
-    DrawText(TextFormat("Scene: %s (%s)", Engine_GetCurrentSceneName(), 
-                       Engine_IsCurrentScene2D() ? "2D" : "3D"), 10, yPos, 20, WHITE);
+    OverlayText("hud.scene", TextFormat("Scene: %s (%s)", Engine_GetCurrentSceneName(), 
+                Engine_IsCurrentScene2D() ? "2D" : "3D"), 10, yPos, 20, WHITE);
     yPos += 25;
     
-    DrawText(TextFormat("Objects: %d/%d", objectCount, MAX_OBJECTS), 10, yPos, 20, WHITE);
+    OverlayText("hud.objects", TextFormat("Objects: %d/%d", objectCount, MAX_OBJECTS), 10, yPos, 20, WHITE);
     yPos += 25;
     
-    DrawText(TextFormat("Wireframe: %s", wireframeMode ? "ON" : "OFF"), 10, yPos, 20, wireframeMode ? YELLOW : WHITE);
+    OverlayText("hud.wireframe", TextFormat("Wireframe: %s", wireframeMode ? "ON" : "OFF"), 10, yPos, 20, wireframeMode ? YELLOW : WHITE);
     yPos += 25;
     
     if (Engine_IsCurrentScene3D())
     {
-        DrawText(TextFormat("Shadows: %s", shadowsEnabled ? "ON" : "OFF"), 10, yPos, 20, shadowsEnabled ? GREEN : WHITE);
+        OverlayText("hud.shadows", TextFormat("Shadows: %s", shadowsEnabled ? "ON" : "OFF"), 10, yPos, 20, shadowsEnabled ? GREEN : WHITE);
+        yPos += 25;
+        
+        OverlayText("hud.fog", TextFormat("Fog: %s", fogEnabled ? "ON" : "OFF"), 10, yPos, 20, fogEnabled ? SKYBLUE : WHITE);
         yPos += 25;
         
-        DrawText(TextFormat("Fog: %s", fogEnabled ? "ON" : "OFF"), 10, yPos, 20, fogEnabled ? SKYBLUE : WHITE);
+        RenderStats* renderStats = GetRenderStats();
+        OverlayText("hud.drawcalls", TextFormat("Draw calls: %d (unbatched %d), state changes: %d", renderStats->drawCalls,
+                    renderStats->drawCallsUnbatched, renderStats->stateChanges), 10, yPos, 20, WHITE);
+        yPos += 25;
+        
+        ResolutionStats* resolution = GetResolutionStats();
+        OverlayText("hud.resolution", TextFormat("Resolution: %d%% (%dx%d)", (int)(resolution->scale * 100.0f + 0.5f),
+                    resolution->width, resolution->height), 10, yPos, 20, WHITE);
+        yPos += 25;
+        
+        CullingStats* cullStats = GetCullingStats();
+        OverlayText("hud.visible", TextFormat("Visible: %d/%d objects (%d impostors), %d/%d particles",
+                    cullStats->visible[CULL_OBJECTS], cullStats->tested[CULL_OBJECTS], renderStats->impostors,
+                    cullStats->visible[CULL_PARTICLES], cullStats->tested[CULL_PARTICLES]),
+                    10, yPos, 20, WHITE);
+        yPos += 25;
+        
+        RenderPipelineStats* pipeline = GetRenderPipelineStats();
+        OverlayText("hud.pipeline", TextFormat("Latency: %d frame(s), record %.2f ms, wait %.2f ms%s", pipeline->latency,
+                    pipeline->recordMs, pipeline->waitMs, pipeline->threaded ? "" : " (inline)"), 10, yPos, 20, WHITE);
+        yPos += 25;
+        
+        LightingStats* lightStats = GetLightingStats();
+        OverlayText("hud.lights", TextFormat("Lights: %d/%d, %d clusters", lightStats->visibleLights,
+                    lightStats->lights, lightStats->occupiedClusters), 10, yPos, 20, WHITE);
         yPos += 25;
     }
     
-    DrawText(TextFormat("Particles: %s", particlesEnabled ? "ON" : "OFF"), 10, yPos, 20, particlesEnabled ? ORANGE : WHITE);
+    OverlayText("hud.particles", TextFormat("Particles: %s", particlesEnabled ? "ON" : "OFF"), 10, yPos, 20, particlesEnabled ? ORANGE : WHITE);
     yPos += 25;
     
-    DrawText(TextFormat("Audio: %s", audioEnabled ? "ON" : "OFF"), 10, yPos, 20, audioEnabled ? PURPLE : WHITE);
+    OverlayText("hud.audio", TextFormat("Audio: %s", audioEnabled ? "ON" : "OFF"), 10, yPos, 20, audioEnabled ? PURPLE : WHITE);
     yPos += 25;
 
+    if (Engine_IsCurrentScene2D())
+    {
+        SpriteBatchStats* spriteStats = GetSpriteBatchStats();
+        OverlayText("hud.sprites", TextFormat("Sprites: %d in %d draw calls", spriteStats->sprites,
+                    spriteStats->drawCalls), 10, yPos, 20, WHITE);
+        yPos += 25;
+    }
+
     if (playerObject && Engine_IsCurrentScene3D())
     {
-        DrawText(TextFormat("Pos: (%.1f, %.1f, %.1f)", 
+        OverlayText("hud.position", TextFormat("Pos: (%.1f, %.1f, %.1f)", 
             playerObject->position.x, playerObject->position.y, playerObject->position.z), 
             10, GetScreenHeight() - 60, 20, LIGHTGRAY);
-        DrawText(TextFormat("Grounded: %s", playerObject->physics.isGrounded ? "YES" : "NO"), 
+        OverlayText("hud.grounded", TextFormat("Grounded: %s", playerObject->physics.isGrounded ? "YES" : "NO"), 
             10, GetScreenHeight() - 35, 20, playerObject->physics.isGrounded ? GREEN : RED);
     }
     
@@ -374,7 +416,11 @@ void RenderAll()
         "F1:Wireframe F2:Shadows F3:Fog F4:Particles F5:Audio F6:NextScene R:Throw P:Burst M:Sound" :
         "F4:Particles F5:Audio F6:NextScene P:Burst M:Sound";
     
-    DrawText(controls, GetScreenWidth() - 500, 10, 20, LIGHTGRAY);
+    OverlayText("hud.controls", controls, GetScreenWidth() - 500, 10, 20, LIGHTGRAY);
+    OverlayGpuTimers(GetScreenWidth() - 300, 40);
+    DrawOverlay();
+    EndGpuPass(GPU_PASS_OVERLAY);
+    EndGpuTimerFrame();
     
     EndDrawing();
 }
@@ -409,6 +455,18 @@ void ToggleShadows(bool enabled)
     SetShadowsEnabled(enabled);
 }
 
+void TogglePhysicsThread(bool enabled)
+{
+    if (enabled)
+    {
+        StartPhysicsThread(PHYSICS_THREAD_DEFAULT_RATE);
+    }
+    else
+    {
+        StopPhysicsThread();
+    }
+}
+
 void ToggleAudio(bool enabled)
 {
     audioEnabled = enabled;
@@ -493,6 +551,8 @@ void CreatePlayerParticleBurst()
         sparks->endColor = (Color){255, 100, 0, 0};
         printf("Created particle burst at player position\n");
     }
+
+    SpawnLightFlash(playerPos, (Color){255, 180, 80, 255}, 12.0f, 8.0f, 0.4f);
 }
 
 void CreateFireEffect(Vector3 position, float intensity)
@@ -568,6 +628,8 @@ void Engine_RegisterScene(const char* name, SceneType type,
 
 void Engine_SwitchScene(const char* name)
 {
+    // The old scene's frames shouldn't show once the new one is up
+    FlushRenderPipeline();
     SwitchScene(name);
 }
 
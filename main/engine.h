@@ -10,6 +10,8 @@
 
 #include "raylib.h"
 #include "physics.h"
+#include "physics_thread.h"
+#include "physics_snapshot.h"
 #include "objects.h"
 #include "camera.h"
 #include "utils.h"
@@ -17,6 +19,23 @@
 #include "particles.h"
 #include "fog.h"
 #include "shadows.h"
+#include "lights.h"
+#include "mesh_cache.h"
+#include "render.h"
+#include "render_pipeline.h"
+#include "command_list.h"
+#include "culling.h"
+#include "occlusion.h"
+#include "lod.h"
+#include "impostors.h"
+#include "static_batch.h"
+#include "overlay.h"
+#include "resolution.h"
+#include "texture_atlas.h"
+#include "texture_loader.h"
+#include "debug_draw.h"
+#include "gpu_timers.h"
+#include "sprite_batch.h"
 #include "audio.h"
 #include "scene.h"
 #include <stdio.h>
@@ -40,6 +59,7 @@ void CloseEngine();
 void UpdateEngine(float deltaTime);
 void RenderAll();
 void ToggleWireframe(bool enabled);
+void TogglePhysicsThread(bool enabled);
 
 void ToggleParticles(bool enabled);
 void CreatePlayerParticleBurst();
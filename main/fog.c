@@ -7,8 +7,85 @@
 
 #include "fog.h"
 #include "engine.h"
+#include "command_list.h"
+#include "rlgl.h"
+#include <math.h>
 #include <stdio.h>
 
+#define FOG_GRID_HALF_SIZE 25
+#define FOG_GRID_LINES (FOG_GRID_HALF_SIZE*2 + 1)
+#define FOG_GRID_SEGMENTS 10   // per line, fallback path only
+
+typedef enum
+{
+    FOG_UNIFORM_ENABLED,
+    FOG_UNIFORM_TYPE,
+    FOG_UNIFORM_DENSITY,
+    FOG_UNIFORM_START,
+    FOG_UNIFORM_END,
+    FOG_UNIFORM_COLOR,
+    FOG_UNIFORM_VIEW_POS,
+    FOG_UNIFORM_COUNT
+} FogUniform;
+
+static const char* fogUniformNames[FOG_UNIFORM_COUNT] = {
+    "fogEnabled", "fogType", "fogDensity", "fogStart", "fogEnd", "fogColor", "viewPos"
+};
+
+typedef struct
+{
+    Shader shader;
+    int locs[FOG_UNIFORM_COUNT];
+} FogShader;
+
+// Grid lines are drawn procedurally on a single ground quad, so the whole
+// grid is one draw call and the fog is evaluated per pixel.
+static const char* fogGridVertexShader =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "uniform mat4 mvp;\n"
+    "uniform mat4 matModel;\n"
+    "out vec3 fragPosition;\n"
+    "void main()\n"
+    "{\n"
+    "    fragPosition = vec3(matModel*vec4(vertexPosition, 1.0));\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char* fogGridFragmentShader =
+    "#version 330\n"
+    "in vec3 fragPosition;\n"
+    "uniform vec4 gridColor;\n"
+    "uniform float gridHalfSize;\n"
+    "out vec4 finalColor;\n"
+    FOG_SHADER_GLSL
+    "void main()\n"
+    "{\n"
+    "    vec2 coord = fragPosition.xz;\n"
+    "    vec2 width = fwidth(coord);\n"
+    "    if (any(greaterThan(abs(coord), vec2(gridHalfSize) + width))) discard;\n"
+    "    vec2 grid = abs(fract(coord + 0.5) - 0.5)/width;\n"
+    "    float line = 1.0 - min(min(grid.x, grid.y), 1.0);\n"
+    "    float alpha = gridColor.a*line*FogFactor(fragPosition);\n"
+    "    if (alpha < 0.04) discard;\n"
+    "    finalColor = vec4(gridColor.rgb, alpha);\n"
+    "}\n";
+
+typedef struct
+{
+    Shader shader;
+    Material material;
+    Mesh mesh;
+    bool ready;
+} FogGrid;
+
+static FogGrid fogGrid = {0};
+
+static FogShader fogShaders[MAX_FOG_SHADERS];
+static int fogShaderCount = 0;
+static FogSettings uploadedSettings;
+static bool uniformsUploaded = false;
+
 static FogSettings fogSettings = {
     .enabled = false,
     .type = FOG_EXPONENTIAL,
@@ -19,11 +96,91 @@ static FogSettings fogSettings = {
     .skyAffected = true
 };
 
+bool RegisterFogShader(Shader shader)
+{
+    if (shader.id == 0 || shader.id == rlGetShaderIdDefault()) return false;
+
+    for (int i = 0; i < fogShaderCount; i++)
+    {
+        if (fogShaders[i].shader.id == shader.id) return true;
+    }
+
+    if (fogShaderCount >= MAX_FOG_SHADERS)
+    {
+        printf("Warning: Too many fog shaders, shader %u won't be fogged\n", shader.id);
+        return false;
+    }
+
+    FogShader* fogShader = &fogShaders[fogShaderCount++];
+    fogShader->shader = shader;
+    for (int u = 0; u < FOG_UNIFORM_COUNT; u++)
+    {
+        fogShader->locs[u] = GetShaderLocation(shader, fogUniformNames[u]);
+    }
+
+    // Bring the newcomer up to date on the next ApplyFog
+    uniformsUploaded = false;
+    return true;
+}
+
+void UnregisterFogShader(Shader shader)
+{
+    for (int i = 0; i < fogShaderCount; i++)
+    {
+        if (fogShaders[i].shader.id != shader.id) continue;
+
+        fogShaders[i] = fogShaders[--fogShaderCount];
+        return;
+    }
+}
+
+static void InitFogGrid()
+{
+    fogGrid.shader = LoadShaderFromMemory(fogGridVertexShader, fogGridFragmentShader);
+    if (!RegisterFogShader(fogGrid.shader))
+    {
+        printf("Warning: Failed to compile fog grid shader\n");
+        return;
+    }
+
+    // One quad a line wider than the grid so the border lines aren't clipped
+    fogGrid.mesh = GenMeshPlane(FOG_GRID_LINES, FOG_GRID_LINES, 1, 1);
+    fogGrid.material = LoadMaterialDefault();
+    fogGrid.material.shader = fogGrid.shader;
+    fogGrid.ready = true;
+
+    Color color = LIGHTGRAY;
+    float gridColor[4] = { color.r/255.0f, color.g/255.0f, color.b/255.0f, 200.0f/255.0f };
+    float halfSize = FOG_GRID_HALF_SIZE;
+    SetShaderValue(fogGrid.shader, GetShaderLocation(fogGrid.shader, "gridColor"), gridColor, SHADER_UNIFORM_VEC4);
+    SetShaderValue(fogGrid.shader, GetShaderLocation(fogGrid.shader, "gridHalfSize"), &halfSize, SHADER_UNIFORM_FLOAT);
+}
+
 void InitFog()
 {
+    if (rlGetVersion() < RL_OPENGL_33)
+    {
+        printf("Fog shaders need GL 3.3, geometry is drawn unfogged\n");
+    }
+    else
+    {
+        InitFogGrid();
+    }
     printf("Fog system initialized\n");
 }
 
+void CloseFog()
+{
+    if (fogGrid.ready)
+    {
+        // UnloadMaterial also releases the shader
+        UnregisterFogShader(fogGrid.shader);
+        UnloadMesh(fogGrid.mesh);
+        UnloadMaterial(fogGrid.material);
+        fogGrid = (FogGrid){0};
+    }
+}
+
 void SetFogEnabled(bool enabled)
 {
     fogSettings.enabled = enabled;
@@ -61,9 +218,132 @@ void SetFogSkyAffected(bool affected)
     printf("Fog sky affected: %s\n", affected ? "yes" : "no");
 }
 
+static bool FogUniformsChanged(const FogSettings* a, const FogSettings* b)
+{
+    return a->enabled != b->enabled || a->type != b->type || a->density != b->density ||
+           a->startDistance != b->startDistance || a->endDistance != b->endDistance ||
+           a->color.r != b->color.r || a->color.g != b->color.g || a->color.b != b->color.b;
+}
+
 void ApplyFog()
 {
-    if (!fogSettings.enabled) return;
+    Vector3 eye = GetCamera()->position;
+    float viewPos[3] = { eye.x, eye.y, eye.z };
+    bool upload = !uniformsUploaded || FogUniformsChanged(&uploadedSettings, &fogSettings);
+
+    int enabled = fogSettings.enabled ? 1 : 0;
+    int type = (int)fogSettings.type;
+    float color[4] = { fogSettings.color.r/255.0f, fogSettings.color.g/255.0f,
+                       fogSettings.color.b/255.0f, 1.0f };
+
+    for (int i = 0; i < fogShaderCount; i++)
+    {
+        FogShader* fogShader = &fogShaders[i];
+        SetShaderValue(fogShader->shader, fogShader->locs[FOG_UNIFORM_VIEW_POS], viewPos, SHADER_UNIFORM_VEC3);
+        if (!upload) continue;
+
+        SetShaderValue(fogShader->shader, fogShader->locs[FOG_UNIFORM_ENABLED], &enabled, SHADER_UNIFORM_INT);
+        SetShaderValue(fogShader->shader, fogShader->locs[FOG_UNIFORM_TYPE], &type, SHADER_UNIFORM_INT);
+        SetShaderValue(fogShader->shader, fogShader->locs[FOG_UNIFORM_DENSITY], &fogSettings.density, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(fogShader->shader, fogShader->locs[FOG_UNIFORM_START], &fogSettings.startDistance, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(fogShader->shader, fogShader->locs[FOG_UNIFORM_END], &fogSettings.endDistance, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(fogShader->shader, fogShader->locs[FOG_UNIFORM_COLOR], color, SHADER_UNIFORM_VEC4);
+    }
+
+    if (upload)
+    {
+        uploadedSettings = fogSettings;
+        uniformsUploaded = true;
+    }
+}
+
+float GetFogFactor(float distance)
+{
+    float factor = 1.0f;
+
+    if (fogSettings.type == FOG_LINEAR)
+    {
+        factor = (fogSettings.endDistance - distance) / (fogSettings.endDistance - fogSettings.startDistance);
+    }
+    else if (fogSettings.type == FOG_EXPONENTIAL)
+    {
+        factor = expf(-fogSettings.density * distance);
+    }
+    else if (fogSettings.type == FOG_EXPONENTIAL_SQUARED)
+    {
+        float d = fogSettings.density * distance;
+        factor = expf(-d * d);
+    }
+
+    return (factor < 0) ? 0 : (factor > 1) ? 1 : factor;
+}
+
+float GetFogCullDistance()
+{
+    // Without a fog shader nothing hides the cut, objects would just pop
+    if (!fogSettings.enabled || fogShaderCount == 0 || !fogGrid.ready) return -1.0f;
+
+    // Distance where the fog factor drops to the remaining visibility
+    float remaining = 1.0f - FOG_CULL_OPACITY;
+
+    if (fogSettings.type == FOG_LINEAR)
+    {
+        return fogSettings.endDistance - remaining * (fogSettings.endDistance - fogSettings.startDistance);
+    }
+
+    if (fogSettings.density <= 0.0f) return -1.0f;
+
+    if (fogSettings.type == FOG_EXPONENTIAL)
+    {
+        return -logf(remaining) / fogSettings.density;
+    }
+    return sqrtf(-logf(remaining)) / fogSettings.density;
+}
+
+// Fog per line vertex through one immediate-mode batch, for GL < 3.3
+static void DrawFogGridLines(Camera3D camera)
+{
+    Color color = LIGHTGRAY;
+    float step = (FOG_GRID_HALF_SIZE * 2.0f) / FOG_GRID_SEGMENTS;
+
+    rlBegin(RL_LINES);
+    for (int i = 0; i < FOG_GRID_LINES; i++)
+    {
+        float offset = (float)(i - FOG_GRID_HALF_SIZE);
+
+        for (int axis = 0; axis < 2; axis++)
+        {
+            for (int s = 0; s < FOG_GRID_SEGMENTS; s++)
+            {
+                for (int end = 0; end < 2; end++)
+                {
+                    float along = -FOG_GRID_HALF_SIZE + (s + end) * step;
+                    Vector3 p = axis == 0 ? (Vector3){offset, 0.01f, along} : (Vector3){along, 0.01f, offset};
+
+                    color.a = (unsigned char)(200 * GetFogFactor(Vector3Length(Vector3Subtract(camera.position, p))));
+                    rlColor4ub(color.r, color.g, color.b, color.a);
+                    rlVertex3f(p.x, p.y, p.z);
+                }
+            }
+        }
+    }
+    rlEnd();
+}
+
+void DrawFogGrid(Camera3D camera)
+{
+    if (!fogGrid.ready)
+    {
+        DrawFogGridLines(camera);
+        return;
+    }
+
+    Matrix transform = { 1, 0, 0, 0,  0, 1, 0, 0.01f,  0, 0, 1, 0,  0, 0, 0, 1 };
+
+    // Translucent overlay: visible from below, and must not hide what's drawn later
+    PushMeshCommand(RENDER_PASS_EFFECTS, &fogGrid.mesh, &fogGrid.material, 0, WHITE, transform,
+                    RENDER_STATE_NO_DEPTH_WRITE | RENDER_STATE_NO_CULLING);
+    SubmitRenderCommands();
 }
 
 void SetDefaultFog()
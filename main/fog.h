@@ -11,6 +11,29 @@
 #include "raylib.h"
 #include <stdbool.h>
 
+#define MAX_FOG_SHADERS 8
+#define FOG_CULL_OPACITY 0.98f   // opaque geometry this deep in fog is culled
+
+// GLSL 330 fog uniforms and FogFactor(worldPosition), 1 = clear, 0 = fully
+// fogged. Shaders that use it are kept up to date after RegisterFogShader.
+#define FOG_SHADER_GLSL \
+    "uniform int fogEnabled;\n" \
+    "uniform int fogType;\n" \
+    "uniform float fogDensity;\n" \
+    "uniform float fogStart;\n" \
+    "uniform float fogEnd;\n" \
+    "uniform vec4 fogColor;\n" \
+    "uniform vec3 viewPos;\n" \
+    "float FogFactor(vec3 position)\n" \
+    "{\n" \
+    "    if (fogEnabled == 0) return 1.0;\n" \
+    "    float dist = distance(viewPos, position);\n" \
+    "    if (fogType == 0) return clamp((fogEnd - dist)/(fogEnd - fogStart), 0.0, 1.0);\n" \
+    "    float d = fogDensity*dist;\n" \
+    "    if (fogType == 1) return clamp(exp(-d), 0.0, 1.0);\n" \
+    "    return clamp(exp(-d*d), 0.0, 1.0);\n" \
+    "}\n"
+
 typedef enum
 {
     FOG_LINEAR,
@@ -30,6 +53,7 @@ typedef struct
 } FogSettings;
 
 void InitFog();
+void CloseFog();
 void SetFogEnabled(bool enabled);
 void SetFogType(FogType type);
 void SetFogColor(Color color);
@@ -43,7 +67,19 @@ void SetForestFog();
 void SetDungeonFog();
 void SetVolumetricFog(float density);
 
+// Call inside BeginMode3D each frame: uploads the camera position, and the
+// fog settings to every registered shader when they've changed
 void ApplyFog();
+bool RegisterFogShader(Shader shader);
+void UnregisterFogShader(Shader shader);
+
+float GetFogFactor(float distance);
+// Distance past which geometry is fully fogged, or -1 when fog is off or
+// no fog shader compiled (nothing would hide the culled objects)
+float GetFogCullDistance();
+
+// Ground grid faded by the current fog, drawn as one cached mesh
+void DrawFogGrid(Camera3D camera);
 FogSettings* GetFogSettings();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,290 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//GPU Pass Timer Implementation
+//==================================================================
+
+#include "gpu_timers.h"
+#include "command_list.h"
+#include "overlay.h"
+#include "rlgl.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#define GPU_TIMER_QUERY_COUNT (GPU_TIMER_FRAMES * GPU_TIMER_SEGMENTS * 2)
+#define GPU_TIMER_BAR_SCALE 20.0f        // pixels per millisecond
+#define GPU_TIMER_BAR_WIDTH 120
+
+#if QWEE_GPU_TIMER_QUERIES
+#define GL_TIMESTAMP 0x8E28
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+
+#if defined(_WIN32) && !defined(_WIN64)
+    #define GPU_APIENTRY __stdcall
+#else
+    #define GPU_APIENTRY
+#endif
+
+// rlgl has no query API; raylib's desktop builds link GLFW, whose loader
+// finds the GL 3.3 entry points
+typedef void (*GpuProc)(void);
+GpuProc glfwGetProcAddress(const char* procname);
+
+typedef void (GPU_APIENTRY *GenQueriesProc)(int count, unsigned int* ids);
+typedef void (GPU_APIENTRY *DeleteQueriesProc)(int count, const unsigned int* ids);
+typedef void (GPU_APIENTRY *QueryCounterProc)(unsigned int id, unsigned int target);
+typedef void (GPU_APIENTRY *GetQueryObjectivProc)(unsigned int id, unsigned int name, int* value);
+typedef void (GPU_APIENTRY *GetQueryObjectui64vProc)(unsigned int id, unsigned int name, uint64_t* value);
+
+static GenQueriesProc genQueries = NULL;
+static DeleteQueriesProc deleteQueries = NULL;
+static QueryCounterProc queryCounter = NULL;
+static GetQueryObjectivProc getQueryObjectiv = NULL;
+static GetQueryObjectui64vProc getQueryObjectui64v = NULL;
+#endif
+
+typedef struct
+{
+    unsigned char pass[GPU_TIMER_SEGMENTS];
+    unsigned int* queries;          // begin/end pair per segment
+    int segments;
+    unsigned int serial;
+    bool pending;
+} TimerFrame;
+
+static const char* passNames[GPU_PASS_COUNT] = { "Objects", "Shadows", "Grid", "Particles", "Sprites", "Overlay" };
+static const char* passKeys[GPU_PASS_COUNT] = { "gpu.objects", "gpu.shadows", "gpu.grid", "gpu.particles", "gpu.sprites", "gpu.overlay" };
+static const char* valueKeys[GPU_PASS_COUNT] = { "gpu.objects.ms", "gpu.shadows.ms", "gpu.grid.ms", "gpu.particles.ms", "gpu.sprites.ms", "gpu.overlay.ms" };
+static const char* barKeys[GPU_PASS_COUNT] = { "gpu.objects.bar", "gpu.shadows.bar", "gpu.grid.bar", "gpu.particles.bar", "gpu.sprites.bar", "gpu.overlay.bar" };
+
+static TimerFrame frames[GPU_TIMER_FRAMES];
+static unsigned int queryPool[GPU_TIMER_QUERY_COUNT];
+static bool queriesReady = false;
+static bool queriesTried = false;
+
+static int currentFrame = -1;       // -1 between EndGpuTimerFrame and BeginGpuTimerFrame
+static int lastFrame = GPU_TIMER_FRAMES - 1;
+static unsigned int frameSerial = 0;
+static int openSegment = -1;
+static double openStart = 0.0;
+static float cpuMs[GPU_PASS_COUNT];
+
+static double sumMs[GPU_PASS_COUNT];
+static int sampleFrames = 0;
+static double reportStart = 0.0;
+
+static GpuTimerStats timerStats = { .enabled = true };
+
+static void InitQueries()
+{
+    queriesTried = true;
+
+#if QWEE_GPU_TIMER_QUERIES
+    if (rlGetVersion() < RL_OPENGL_33 || GetRenderBackend() == RENDER_BACKEND_NULL) return;
+
+    genQueries = (GenQueriesProc)glfwGetProcAddress("glGenQueries");
+    deleteQueries = (DeleteQueriesProc)glfwGetProcAddress("glDeleteQueries");
+    queryCounter = (QueryCounterProc)glfwGetProcAddress("glQueryCounter");
+    getQueryObjectiv = (GetQueryObjectivProc)glfwGetProcAddress("glGetQueryObjectiv");
+    getQueryObjectui64v = (GetQueryObjectui64vProc)glfwGetProcAddress("glGetQueryObjectui64v");
+
+    if (!genQueries || !deleteQueries || !queryCounter || !getQueryObjectiv || !getQueryObjectui64v)
+    {
+        printf("Warning: GPU timer queries unavailable, timing passes on the CPU\n");
+        return;
+    }
+
+    genQueries(GPU_TIMER_QUERY_COUNT, queryPool);
+    queriesReady = true;
+#endif
+}
+
+static void AccumulateFrame(const float* passMs)
+{
+    for (int p = 0; p < GPU_PASS_COUNT; p++) sumMs[p] += passMs[p];
+    sampleFrames++;
+
+    double now = GetTime();
+    if (now - reportStart < GPU_TIMER_REPORT_INTERVAL) return;
+
+    // Published at a fixed rate so the overlay text holds still long enough to read
+    timerStats.totalMs = 0.0f;
+    for (int p = 0; p < GPU_PASS_COUNT; p++)
+    {
+        timerStats.passMs[p] = (float)(sumMs[p] / sampleFrames);
+        timerStats.totalMs += timerStats.passMs[p];
+        sumMs[p] = 0.0;
+    }
+    sampleFrames = 0;
+    reportStart = now;
+}
+
+// Oldest first; stops at the first frame the GPU hasn't finished
+static void ResolveFrames()
+{
+#if QWEE_GPU_TIMER_QUERIES
+    for (int i = 1; i <= GPU_TIMER_FRAMES; i++)
+    {
+        TimerFrame* frame = &frames[(lastFrame + i) % GPU_TIMER_FRAMES];
+        if (!frame->pending) continue;
+
+        int available = 0;
+        getQueryObjectiv(frame->queries[frame->segments * 2 - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) return;
+
+        float passMs[GPU_PASS_COUNT] = {0};
+        for (int s = 0; s < frame->segments; s++)
+        {
+            uint64_t begin = 0, end = 0;
+            getQueryObjectui64v(frame->queries[s * 2], GL_QUERY_RESULT, &begin);
+            getQueryObjectui64v(frame->queries[s * 2 + 1], GL_QUERY_RESULT, &end);
+            if (end > begin) passMs[frame->pass[s]] += (float)((end - begin) / 1000000.0);
+        }
+
+        timerStats.latency = (int)(frameSerial - frame->serial);
+        frame->pending = false;
+        AccumulateFrame(passMs);
+    }
+#endif
+}
+
+static void StampQuery(unsigned int query)
+{
+#if QWEE_GPU_TIMER_QUERIES
+    queryCounter(query, GL_TIMESTAMP);
+#else
+    (void)query;
+#endif
+}
+
+void BeginGpuTimerFrame()
+{
+    if (!timerStats.enabled) return;
+    if (!queriesTried) InitQueries();
+
+    timerStats.gpuQueries = queriesReady;
+    frameSerial++;
+    if (queriesReady) ResolveFrames();
+
+    int next = (lastFrame + 1) % GPU_TIMER_FRAMES;
+    TimerFrame* frame = &frames[next];
+
+    if (frame->pending)
+    {
+        timerStats.dropped++;
+        frame->pending = false;
+    }
+
+    frame->queries = &queryPool[next * GPU_TIMER_SEGMENTS * 2];
+    frame->segments = 0;
+    frame->serial = frameSerial;
+    for (int p = 0; p < GPU_PASS_COUNT; p++) cpuMs[p] = 0.0f;
+
+    currentFrame = next;
+    openSegment = -1;
+}
+
+void EndGpuTimerFrame()
+{
+    if (currentFrame < 0) return;
+
+    TimerFrame* frame = &frames[currentFrame];
+    if (openSegment >= 0) EndGpuPass((GpuPass)frame->pass[openSegment]);
+
+    if (queriesReady) frame->pending = (frame->segments > 0);
+    else AccumulateFrame(cpuMs);
+
+    lastFrame = currentFrame;
+    currentFrame = -1;
+}
+
+void BeginGpuPass(GpuPass pass)
+{
+    if (currentFrame < 0 || (unsigned int)pass >= GPU_PASS_COUNT) return;
+
+    TimerFrame* frame = &frames[currentFrame];
+    if (openSegment >= 0) EndGpuPass((GpuPass)frame->pass[openSegment]);
+
+    if (frame->segments >= GPU_TIMER_SEGMENTS)
+    {
+        timerStats.overflows++;
+        return;
+    }
+
+    // Whatever raylib batched so far belongs to the previous pass
+    rlDrawRenderBatchActive();
+
+    openSegment = frame->segments++;
+    frame->pass[openSegment] = (unsigned char)pass;
+    if (queriesReady) StampQuery(frame->queries[openSegment * 2]);
+    else openStart = GetTime();
+}
+
+void EndGpuPass(GpuPass pass)
+{
+    if (currentFrame < 0 || openSegment < 0) return;
+
+    TimerFrame* frame = &frames[currentFrame];
+    if (frame->pass[openSegment] != pass) return;
+
+    rlDrawRenderBatchActive();
+
+    if (queriesReady) StampQuery(frame->queries[openSegment * 2 + 1]);
+    else cpuMs[pass] += (float)((GetTime() - openStart) * 1000.0);
+
+    openSegment = -1;
+}
+
+void OverlayGpuTimers(int x, int y)
+{
+    if (!timerStats.enabled) return;
+
+    OverlayText("gpu.title", TextFormat("%s time: %.2f ms", timerStats.gpuQueries ? "GPU" : "CPU submit",
+                timerStats.totalMs), x, y, 20, WHITE);
+
+    for (int p = 0; p < GPU_PASS_COUNT; p++)
+    {
+        int width = (int)(timerStats.passMs[p] * GPU_TIMER_BAR_SCALE);
+        if (width > GPU_TIMER_BAR_WIDTH) width = GPU_TIMER_BAR_WIDTH;
+
+        y += 22;
+        OverlayText(passKeys[p], passNames[p], x, y, 20, LIGHTGRAY);
+        OverlayText(valueKeys[p], TextFormat("%.2f", timerStats.passMs[p]), x + 100, y, 20, LIGHTGRAY);
+        OverlayRect(barKeys[p], x + 160, y + 4, width > 0 ? width : 1, 12, width >= GPU_TIMER_BAR_WIDTH ? RED : LIME);
+    }
+}
+
+const char* GetGpuPassName(GpuPass pass)
+{
+    return ((unsigned int)pass < GPU_PASS_COUNT) ? passNames[pass] : "Unknown";
+}
+
+void SetGpuTimersEnabled(bool enabled)
+{
+    timerStats.enabled = enabled;
+    if (enabled) return;
+
+    for (int i = 0; i < GPU_TIMER_FRAMES; i++) frames[i].pending = false;
+    currentFrame = -1;
+    openSegment = -1;
+}
+
+void CloseGpuTimers()
+{
+#if QWEE_GPU_TIMER_QUERIES
+    if (queriesReady) deleteQueries(GPU_TIMER_QUERY_COUNT, queryPool);
+#endif
+
+    for (int i = 0; i < GPU_TIMER_FRAMES; i++) frames[i].pending = false;
+    queriesReady = false;
+    queriesTried = false;
+    currentFrame = -1;
+    openSegment = -1;
+}
+
+GpuTimerStats* GetGpuTimerStats()
+{
+    return &timerStats;
+}
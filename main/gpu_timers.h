@@ -0,0 +1,67 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//GPU Pass Timer Module
+//==================================================================
+
+#ifndef GPU_TIMERS_H
+#define GPU_TIMERS_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+// Timestamp queries need desktop GL 3.3 and GLFW's loader from raylib;
+// define QWEE_GPU_TIMER_QUERIES 0 to always time on the CPU
+#ifndef QWEE_GPU_TIMER_QUERIES
+    #if defined(__EMSCRIPTEN__) || defined(PLATFORM_WEB) || defined(PLATFORM_ANDROID)
+        #define QWEE_GPU_TIMER_QUERIES 0
+    #else
+        #define QWEE_GPU_TIMER_QUERIES 1
+    #endif
+#endif
+
+#define GPU_TIMER_FRAMES 4               // frames in flight before results are dropped
+#define GPU_TIMER_SEGMENTS 16            // Begin/End pairs per frame
+#define GPU_TIMER_REPORT_INTERVAL 0.5f   // seconds averaged into each published value
+
+typedef enum
+{
+    GPU_PASS_OBJECTS,
+    GPU_PASS_SHADOWS,
+    GPU_PASS_GRID,                  // fog grid and the debug line flush
+    GPU_PASS_PARTICLES,
+    GPU_PASS_SPRITES,
+    GPU_PASS_OVERLAY,
+    GPU_PASS_COUNT
+} GpuPass;
+
+typedef struct
+{
+    bool enabled;
+    bool gpuQueries;                // false: CPU submission time instead
+    float passMs[GPU_PASS_COUNT];
+    float totalMs;
+    int latency;                    // frames between issuing and reading a result
+    int dropped;                    // frames still unresolved when their slot came round
+    int overflows;
+} GpuTimerStats;
+
+// A frame runs from BeginGpuTimerFrame in UpdateEngine to EndGpuTimerFrame
+// after the overlay. Each pass may be timed several times per frame and
+// is summed; starting a pass ends the open one. Timestamps are read back
+// only once available, so timing never waits on the GPU.
+void BeginGpuTimerFrame();
+void EndGpuTimerFrame();
+void BeginGpuPass(GpuPass pass);
+void EndGpuPass(GpuPass pass);
+
+// Adds a per-pass table with bars to the HUD overlay
+void OverlayGpuTimers(int x, int y);
+const char* GetGpuPassName(GpuPass pass);
+
+void SetGpuTimersEnabled(bool enabled);
+void CloseGpuTimers();
+GpuTimerStats* GetGpuTimerStats();
+
+#endif
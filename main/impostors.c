@@ -0,0 +1,371 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Impostor Implementation
+//==================================================================
+
+#include "impostors.h"
+#include "command_list.h"
+#include "texture_atlas.h"
+#include "vector_math.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdio.h>
+
+#define IMPOSTOR_PITCH_START -20.0f
+#define IMPOSTOR_PITCH_STEP 30.0f
+
+typedef enum
+{
+    IMPOSTOR_FREE,
+    IMPOSTOR_PENDING,
+    IMPOSTOR_READY
+} ImpostorState;
+
+typedef struct
+{
+    ImpostorState state;
+    MeshPrimitive primitive;
+    unsigned int textureId;
+    unsigned char shape[3];
+    Vector3 center;                 // bounds in units of the largest scale axis
+    float radius;
+    unsigned int lastUsed;
+} Impostor;
+
+// Flat shaded from above so the silhouette still reads; the instancing
+// shader adds shadows, lights and fog on top at draw time
+static const char* bakeVertexShader =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec3 vertexNormal;\n"
+    "uniform mat4 mvp;\n"
+    "uniform mat4 matNormal;\n"
+    "uniform vec4 uvRect;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec3 fragNormal;\n"
+    "void main()\n"
+    "{\n"
+    "    fragTexCoord = uvRect.xy + vertexTexCoord*uvRect.zw;\n"
+    "    fragNormal = mat3(matNormal)*vertexNormal;\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char* bakeFragmentShader =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec3 fragNormal;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    float light = 0.55 + 0.45*max(dot(normalize(fragNormal), normalize(vec3(0.3, 1.0, 0.2))), 0.0);\n"
+    "    finalColor = vec4(texture(texture0, fragTexCoord).rgb*colDiffuse.rgb*light, 1.0);\n"
+    "}\n";
+
+static Impostor impostors[MAX_IMPOSTORS];
+static unsigned int frameIndex = 0;
+
+static RenderTexture2D atlas = {0};
+static Material bakeMaterial;
+static int uvRectLoc = -1;
+static bool resourcesReady = false;
+
+static ImpostorSettings impostorSettings = {
+    .enabled = true,
+    .distance = 60.0f,
+    .fadeRange = 8.0f,
+    .bakesPerFrame = 2
+};
+static ImpostorStats impostorStats = {0};
+
+static Vector3 GetViewDirection(int view)
+{
+    float yaw = (view % IMPOSTOR_YAW_VIEWS) * 2.0f * PI / IMPOSTOR_YAW_VIEWS;
+    float pitch = (IMPOSTOR_PITCH_START + (view / IMPOSTOR_YAW_VIEWS) * IMPOSTOR_PITCH_STEP) * DEG2RAD;
+
+    return (Vector3){ cosf(pitch) * sinf(yaw), sinf(pitch), cosf(pitch) * cosf(yaw) };
+}
+
+static int GetNearestView(Vector3 toEye)
+{
+    float yaw = atan2f(toEye.x, toEye.z);
+    float pitch = asinf(fmaxf(-1.0f, fminf(toEye.y, 1.0f))) * RAD2DEG;
+
+    int yawIndex = (int)floorf(yaw / (2.0f * PI / IMPOSTOR_YAW_VIEWS) + 0.5f);
+    yawIndex = ((yawIndex % IMPOSTOR_YAW_VIEWS) + IMPOSTOR_YAW_VIEWS) % IMPOSTOR_YAW_VIEWS;
+
+    int pitchIndex = (int)floorf((pitch - IMPOSTOR_PITCH_START) / IMPOSTOR_PITCH_STEP + 0.5f);
+    if (pitchIndex < 0) pitchIndex = 0;
+    if (pitchIndex > IMPOSTOR_PITCH_VIEWS - 1) pitchIndex = IMPOSTOR_PITCH_VIEWS - 1;
+
+    return pitchIndex * IMPOSTOR_YAW_VIEWS + yawIndex;
+}
+
+static unsigned char QuantizeShape(float fraction)
+{
+    int step = (int)(fraction * IMPOSTOR_SHAPE_STEPS + 0.5f);
+
+    if (step < 1) step = 1;
+    if (step > IMPOSTOR_SHAPE_STEPS) step = IMPOSTOR_SHAPE_STEPS;
+    return (unsigned char)step;
+}
+
+static Impostor* FindImpostor(MeshPrimitive primitive, unsigned int textureId, const unsigned char* shape)
+{
+    for (int i = 0; i < MAX_IMPOSTORS; i++)
+    {
+        Impostor* imp = &impostors[i];
+        if (imp->state != IMPOSTOR_FREE && imp->primitive == primitive && imp->textureId == textureId &&
+            imp->shape[0] == shape[0] && imp->shape[1] == shape[1] && imp->shape[2] == shape[2])
+        {
+            return imp;
+        }
+    }
+    return NULL;
+}
+
+// A free row, or else the one unused the longest if it has been idle a while
+static Impostor* AcquireImpostor()
+{
+    Impostor* oldest = NULL;
+
+    for (int i = 0; i < MAX_IMPOSTORS; i++)
+    {
+        Impostor* imp = &impostors[i];
+        if (imp->state == IMPOSTOR_FREE) return imp;
+        if (imp->state == IMPOSTOR_READY && (!oldest || imp->lastUsed < oldest->lastUsed)) oldest = imp;
+    }
+
+    if (!oldest || frameIndex - oldest->lastUsed < IMPOSTOR_EVICT_FRAMES) return NULL;
+
+    oldest->state = IMPOSTOR_FREE;
+    impostorStats.impostors--;
+    impostorStats.evicted++;
+    return oldest;
+}
+
+static bool InitImpostorResources()
+{
+    if (resourcesReady) return true;
+
+    Shader bakeShader = LoadShaderFromMemory(bakeVertexShader, bakeFragmentShader);
+    if (bakeShader.id == 0 || bakeShader.id == rlGetShaderIdDefault())
+    {
+        printf("Warning: Impostor bake shader failed, impostors disabled\n");
+        return false;
+    }
+
+    atlas = LoadRenderTexture(IMPOSTOR_ATLAS_SIZE, IMPOSTOR_ATLAS_SIZE);
+    if (atlas.id == 0)
+    {
+        printf("Warning: Could not create impostor atlas, impostors disabled\n");
+        UnloadShader(bakeShader);
+        return false;
+    }
+    SetTextureFilter(atlas.texture, TEXTURE_FILTER_BILINEAR);
+
+    bakeMaterial = LoadMaterialDefault();
+    bakeMaterial.shader = bakeShader;
+    uvRectLoc = GetShaderLocation(bakeShader, "uvRect");
+
+    resourcesReady = true;
+    return true;
+}
+
+static void BakeImpostor(int index)
+{
+    Impostor* imp = &impostors[index];
+    Mesh* mesh = &GetCachedModelLod(imp->primitive, 0)->meshes[0];
+    Vector3 shape = { (float)imp->shape[0] / IMPOSTOR_SHAPE_STEPS, (float)imp->shape[1] / IMPOSTOR_SHAPE_STEPS,
+                      (float)imp->shape[2] / IMPOSTOR_SHAPE_STEPS };
+    BoundingBox box = GetMeshBoundingBox(*mesh);
+    Vector3 extent = { (box.max.x - box.min.x) * shape.x, (box.max.y - box.min.y) * shape.y,
+                       (box.max.z - box.min.z) * shape.z };
+
+    imp->center = (Vector3){ (box.min.x + box.max.x) * 0.5f * shape.x, (box.min.y + box.max.y) * 0.5f * shape.y,
+                             (box.min.z + box.max.z) * 0.5f * shape.z };
+    imp->radius = Vector3Length(extent) * 0.5f;
+
+    Matrix transform = { shape.x, 0, 0, 0,
+                         0, shape.y, 0, 0,
+                         0, 0, shape.z, 0,
+                         0, 0, 0, 1 };
+    // Atlased textures have no standalone upload left to sample
+    unsigned int textureId = imp->textureId;
+    float uvRect[4];
+    RemapAtlasTexture(&textureId, uvRect);
+    if (textureId == 0) textureId = rlGetTextureIdDefault();
+    SetShaderValue(bakeMaterial.shader, uvRectLoc, uvRect, SHADER_UNIFORM_VEC4);
+
+    int y = index * IMPOSTOR_CELL_SIZE;
+
+    BeginTextureMode(atlas);
+    rlEnableScissorTest();
+
+    for (int view = 0; view < IMPOSTOR_VIEWS; view++)
+    {
+        int x = view * IMPOSTOR_CELL_SIZE;
+        Camera3D camera = {0};
+        camera.position = Vector3Add(imp->center, Vector3Scale(GetViewDirection(view), imp->radius * 4.0f));
+        camera.target = imp->center;
+        camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+        camera.fovy = imp->radius * 2.0f;
+        camera.projection = CAMERA_ORTHOGRAPHIC;
+
+        // Viewport and scissor in GL coordinates, so row 0 is the bottom
+        rlViewport(x, y, IMPOSTOR_CELL_SIZE, IMPOSTOR_CELL_SIZE);
+        rlScissor(x, y, IMPOSTOR_CELL_SIZE, IMPOSTOR_CELL_SIZE);
+        rlClearColor(0, 0, 0, 0);
+        rlClearScreenBuffers();
+
+        BeginMode3D(camera);
+        PushMeshCommand(RENDER_PASS_GEOMETRY, mesh, &bakeMaterial, textureId, WHITE, transform, 0);
+        SubmitRenderCommands();
+        EndMode3D();
+    }
+
+    rlDisableScissorTest();
+    EndTextureMode();
+}
+
+float GetImpostorFade(Vector3 position, Vector3 eye)
+{
+    if (!impostorSettings.enabled) return 0.0f;
+
+    float distance = Vector3Length(Vector3Subtract(position, eye));
+    if (distance <= impostorSettings.distance) return 0.0f;
+    if (impostorSettings.fadeRange <= 0.0f) return 1.0f;
+
+    return fminf((distance - impostorSettings.distance) / impostorSettings.fadeRange, 1.0f);
+}
+
+bool MakeImpostorInstance(MeshPrimitive primitive, unsigned int textureId, Vector3 position,
+                          Vector3 scale, Color color, Vector3 eye, InstanceData* instance)
+{
+    float size = fmaxf(scale.x, fmaxf(scale.y, scale.z));
+    if (size <= 0.0f) return false;
+
+    unsigned char shape[3] = { QuantizeShape(scale.x / size), QuantizeShape(scale.y / size),
+                               QuantizeShape(scale.z / size) };
+    Impostor* imp = FindImpostor(primitive, textureId, shape);
+
+    if (!imp)
+    {
+        imp = AcquireImpostor();
+        if (!imp)
+        {
+            impostorStats.rejected++;
+            return false;
+        }
+
+        *imp = (Impostor){ .state = IMPOSTOR_PENDING, .primitive = primitive, .textureId = textureId,
+                           .shape = { shape[0], shape[1], shape[2] } };
+        impostorStats.impostors++;
+        impostorStats.pending++;
+    }
+
+    imp->lastUsed = frameIndex;
+    if (imp->state != IMPOSTOR_READY) return false;
+
+    Vector3 center = Vector3Add(position, Vector3Scale(imp->center, size));
+    float radius = imp->radius * size;
+    Vector3 toEye = Vector3Subtract(eye, center);
+    float distance = Vector3Length(toEye);
+    if (distance <= radius) return false;
+    toEye = Vector3Scale(toEye, 1.0f / distance);
+
+    // Same right/up the bake camera had for this direction
+    Vector3 right = Vector3CrossProduct((Vector3){ 0.0f, 1.0f, 0.0f }, toEye);
+    right = (Vector3Length(right) < 0.001f) ? (Vector3){ 1.0f, 0.0f, 0.0f } : Vector3Normalize(right);
+    Vector3 up = Vector3CrossProduct(toEye, right);
+    float diameter = radius * 2.0f;
+
+    int view = GetNearestView(toEye);
+    float texel = 1.0f / IMPOSTOR_ATLAS_SIZE;
+    int row = (int)(imp - impostors);
+
+    *instance = (InstanceData){
+        { right.x * diameter, right.y * diameter, right.z * diameter, 0,
+          up.x * diameter, up.y * diameter, up.z * diameter, 0,
+          toEye.x, toEye.y, toEye.z, 0,
+          center.x, center.y, center.z, 1 },
+        color,
+        { (view * IMPOSTOR_CELL_SIZE + 0.5f) * texel, (row * IMPOSTOR_CELL_SIZE + 0.5f) * texel,
+          (IMPOSTOR_CELL_SIZE - 1.0f) * texel, (IMPOSTOR_CELL_SIZE - 1.0f) * texel }
+    };
+    return true;
+}
+
+void UpdateImpostors()
+{
+    frameIndex++;
+    impostorStats.rejected = 0;
+
+    if (!impostorSettings.enabled || impostorStats.pending == 0) return;
+    if (rlGetVersion() < RL_OPENGL_33 || GetRenderBackend() == RENDER_BACKEND_NULL) return;
+
+    if (!InitImpostorResources())
+    {
+        impostorSettings.enabled = false;
+        return;
+    }
+
+    int budget = impostorSettings.bakesPerFrame;
+    for (int i = 0; i < MAX_IMPOSTORS && budget > 0; i++)
+    {
+        if (impostors[i].state != IMPOSTOR_PENDING) continue;
+
+        BakeImpostor(i);
+        impostors[i].state = IMPOSTOR_READY;
+        impostorStats.pending--;
+        impostorStats.baked++;
+        budget--;
+    }
+}
+
+const Mesh* GetImpostorMesh()
+{
+    return GetCachedQuadMesh();
+}
+
+unsigned int GetImpostorAtlasTexture()
+{
+    return atlas.texture.id;
+}
+
+void ClearImpostors()
+{
+    for (int i = 0; i < MAX_IMPOSTORS; i++) impostors[i].state = IMPOSTOR_FREE;
+
+    impostorStats.impostors = 0;
+    impostorStats.pending = 0;
+}
+
+void CloseImpostors()
+{
+    ClearImpostors();
+    if (!resourcesReady) return;
+
+    UnloadRenderTexture(atlas);
+
+    // Only the shader is ours; the diffuse map holds whatever was baked last
+    bakeMaterial.maps[MATERIAL_MAP_DIFFUSE].texture.id = rlGetTextureIdDefault();
+    UnloadMaterial(bakeMaterial);
+
+    atlas = (RenderTexture2D){0};
+    resourcesReady = false;
+}
+
+ImpostorSettings* GetImpostorSettings()
+{
+    return &impostorSettings;
+}
+
+ImpostorStats* GetImpostorStats()
+{
+    return &impostorStats;
+}
@@ -0,0 +1,66 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Impostor Module
+//==================================================================
+
+#ifndef IMPOSTORS_H
+#define IMPOSTORS_H
+
+#include "raylib.h"
+#include "mesh_cache.h"
+#include "instancing.h"
+#include <stdbool.h>
+
+#define IMPOSTOR_ATLAS_SIZE 2048
+#define IMPOSTOR_CELL_SIZE 64            // pixels per baked view
+#define IMPOSTOR_YAW_VIEWS 8
+#define IMPOSTOR_PITCH_VIEWS 4           // -20, 10, 40 and 70 degrees
+#define IMPOSTOR_VIEWS (IMPOSTOR_YAW_VIEWS * IMPOSTOR_PITCH_VIEWS)
+#define MAX_IMPOSTORS (IMPOSTOR_ATLAS_SIZE / IMPOSTOR_CELL_SIZE)   // one atlas row each
+#define IMPOSTOR_SHAPE_STEPS 16          // proportions are keyed in 1/16ths
+#define IMPOSTOR_EVICT_FRAMES 120
+
+typedef struct
+{
+    bool enabled;
+    float distance;                 // impostors start here...
+    float fadeRange;                // ...and fully replace the mesh this much further
+    int bakesPerFrame;
+} ImpostorSettings;
+
+typedef struct
+{
+    int impostors;
+    int pending;
+    int baked;
+    int evicted;
+    int rejected;                   // objects drawn as meshes this frame, atlas full
+} ImpostorStats;
+
+// How far into the cross-fade an object is: 0 draws only the mesh,
+// 1 only the impostor, and anything between draws both
+float GetImpostorFade(Vector3 position, Vector3 eye);
+
+// Fills a camera-facing quad sampling the baked view nearest the eye.
+// A shape seen for the first time is queued for baking and returns false
+// until UpdateImpostors has drawn it, so the caller keeps the mesh. Runs
+// on the render worker while a frame records; the table is the main
+// thread's again once FinishRenderPipeline returns.
+bool MakeImpostorInstance(MeshPrimitive primitive, unsigned int textureId, Vector3 position,
+                          Vector3 scale, Color color, Vector3 eye, InstanceData* instance);
+
+// Bakes queued shapes into the atlas offscreen and starts a new frame
+// of stats; call outside any texture or 3D mode and while no frame is
+// recording, as UpdateEngine does
+void UpdateImpostors();
+const Mesh* GetImpostorMesh();
+unsigned int GetImpostorAtlasTexture();
+void ClearImpostors();
+void CloseImpostors();
+
+ImpostorSettings* GetImpostorSettings();
+ImpostorStats* GetImpostorStats();
+
+#endif
@@ -0,0 +1,261 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Instanced Drawing Implementation
+//==================================================================
+
+#include "instancing.h"
+#include "vector_math.h"
+#include "fog.h"
+#include "shadows.h"
+#include "lights.h"
+#include "rlgl.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+static const char* instanceVertexShader =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec3 vertexNormal;\n"
+    "in mat4 instanceTransform;\n"
+    "in vec4 instanceColor;\n"
+    "in vec4 instanceUvRect;\n"
+    "uniform mat4 mvp;\n"
+    "out vec3 fragPosition;\n"
+    "out vec3 fragNormal;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec4 fragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 position = instanceTransform*vec4(vertexPosition, 1.0);\n"
+    "    fragPosition = position.xyz;\n"
+    "    fragNormal = mat3(instanceTransform)*vertexNormal;\n"
+    "    fragTexCoord = instanceUvRect.xy + vertexTexCoord*instanceUvRect.zw;\n"
+    "    fragColor = instanceColor;\n"
+    "    gl_Position = mvp*position;\n"
+    "}\n";
+
+static const char* instanceFragmentShader =
+    "#version 330\n"
+    "in vec3 fragPosition;\n"
+    "in vec3 fragNormal;\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "out vec4 finalColor;\n"
+    FOG_SHADER_GLSL
+    SHADOW_SHADER_GLSL
+    LIGHT_SHADER_GLSL
+    "void main()\n"
+    "{\n"
+    "    vec4 color = texture(texture0, fragTexCoord)*fragColor;\n"
+    "    if (color.a < 0.01) discard;\n"
+    "    vec3 albedo = color.rgb;\n"
+    "    color.rgb = mix(color.rgb, shadowColor.rgb, ShadowAmount(fragPosition, fragNormal));\n"
+    "    color.rgb += ClusterLighting(fragPosition, fragNormal, albedo);\n"
+    "    finalColor = vec4(mix(fogColor.rgb, color.rgb, FogFactor(fragPosition)), color.a);\n"
+    "}\n";
+
+static Shader instanceShader = {0};
+static int mvpLoc = -1;
+static int textureLoc = -1;
+static int transformLoc = -1;
+static int colorLoc = -1;
+static int uvRectLoc = -1;
+
+static unsigned int streamVbo = 0;
+static int streamCursor = 0;
+static bool instancingReady = false;
+
+static Material fallbackMaterial;
+static bool fallbackReady = false;
+
+bool InitInstancing()
+{
+    if (instancingReady) return true;
+
+    if (rlGetVersion() < RL_OPENGL_33)
+    {
+        printf("Instancing not supported by this GL version, drawing per object\n");
+        return false;
+    }
+
+    instanceShader = LoadShaderFromMemory(instanceVertexShader, instanceFragmentShader);
+    if (instanceShader.id == 0 || instanceShader.id == rlGetShaderIdDefault())
+    {
+        printf("Warning: Failed to compile instancing shader\n");
+        return false;
+    }
+
+    mvpLoc = rlGetLocationUniform(instanceShader.id, "mvp");
+    textureLoc = rlGetLocationUniform(instanceShader.id, "texture0");
+    transformLoc = rlGetLocationAttrib(instanceShader.id, "instanceTransform");
+    colorLoc = rlGetLocationAttrib(instanceShader.id, "instanceColor");
+    uvRectLoc = rlGetLocationAttrib(instanceShader.id, "instanceUvRect");
+
+    RegisterFogShader(instanceShader);
+    RegisterShadowShader(instanceShader);
+    RegisterLightShader(instanceShader);
+
+    streamVbo = rlLoadVertexBuffer(NULL, INSTANCE_BUFFER_CAPACITY * sizeof(InstanceData), true);
+    streamCursor = 0;
+    instancingReady = (streamVbo != 0 && transformLoc >= 0 && colorLoc >= 0 && uvRectLoc >= 0);
+
+    if (!instancingReady) printf("Warning: Instancing setup failed, drawing per object\n");
+    return instancingReady;
+}
+
+void CloseInstancing()
+{
+    if (streamVbo) rlUnloadVertexBuffer(streamVbo);
+    if (instanceShader.id)
+    {
+        UnregisterFogShader(instanceShader);
+        UnregisterShadowShader(instanceShader);
+        UnregisterLightShader(instanceShader);
+        UnloadShader(instanceShader);
+    }
+    if (fallbackReady)
+    {
+        // Only the shader/map arrays belong to us, textures are the caller's
+        fallbackMaterial.maps[MATERIAL_MAP_DIFFUSE].texture.id = rlGetTextureIdDefault();
+        UnloadMaterial(fallbackMaterial);
+    }
+
+    streamVbo = 0;
+    instanceShader = (Shader){0};
+    instancingReady = false;
+    fallbackReady = false;
+}
+
+bool IsInstancingSupported()
+{
+    return instancingReady;
+}
+
+InstanceData MakeInstance(Vector3 position, Vector3 scale, Color color)
+{
+    InstanceData instance = {
+        { scale.x, 0, 0, 0,
+          0, scale.y, 0, 0,
+          0, 0, scale.z, 0,
+          position.x, position.y, position.z, 1 },
+        color,
+        { 0, 0, 1, 1 }
+    };
+    return instance;
+}
+
+static void DrawInstancesFallback(Mesh mesh, unsigned int textureId, const InstanceData* instances, int count)
+{
+    if (!fallbackReady)
+    {
+        fallbackMaterial = LoadMaterialDefault();
+        fallbackReady = true;
+    }
+
+    fallbackMaterial.maps[MATERIAL_MAP_DIFFUSE].texture.id = textureId ? textureId : rlGetTextureIdDefault();
+
+    for (int i = 0; i < count; i++)
+    {
+        const float* t = instances[i].transform;
+        Matrix transform = {
+            t[0], t[4], t[8],  t[12],
+            t[1], t[5], t[9],  t[13],
+            t[2], t[6], t[10], t[14],
+            t[3], t[7], t[11], t[15]
+        };
+
+        fallbackMaterial.maps[MATERIAL_MAP_DIFFUSE].color = instances[i].color;
+        DrawMesh(mesh, fallbackMaterial, transform);
+    }
+}
+
+static void SetInstanceAttributes(size_t base)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        rlEnableVertexAttribute(transformLoc + i);
+        rlSetVertexAttribute(transformLoc + i, 4, RL_FLOAT, false, sizeof(InstanceData),
+                             (const void*)(uintptr_t)(base + i * 4 * sizeof(float)));
+        rlSetVertexAttributeDivisor(transformLoc + i, 1);
+    }
+
+    rlEnableVertexAttribute(colorLoc);
+    rlSetVertexAttribute(colorLoc, 4, RL_UNSIGNED_BYTE, true, sizeof(InstanceData),
+                         (const void*)(uintptr_t)(base + offsetof(InstanceData, color)));
+    rlSetVertexAttributeDivisor(colorLoc, 1);
+
+    rlEnableVertexAttribute(uvRectLoc);
+    rlSetVertexAttribute(uvRectLoc, 4, RL_FLOAT, false, sizeof(InstanceData),
+                         (const void*)(uintptr_t)(base + offsetof(InstanceData, uvRect)));
+    rlSetVertexAttributeDivisor(uvRectLoc, 1);
+}
+
+// Rewriting a range an earlier draw may still be reading would make the
+// driver wait for it, so on wrap the stream gets fresh storage instead,
+// as the sprite batch does on every flush
+static void OrphanStreamBuffer()
+{
+    rlUnloadVertexBuffer(streamVbo);
+    streamVbo = rlLoadVertexBuffer(NULL, INSTANCE_BUFFER_CAPACITY * sizeof(InstanceData), true);
+    rlEnableVertexBuffer(streamVbo);
+    streamCursor = 0;
+}
+
+void DrawInstances(Mesh mesh, unsigned int textureId, const InstanceData* instances, int count)
+{
+    if (count <= 0) return;
+
+    if (!instancingReady)
+    {
+        DrawInstancesFallback(mesh, textureId, instances, count);
+        return;
+    }
+
+    // Anything queued in raylib's immediate batch must land first
+    rlDrawRenderBatchActive();
+
+    Matrix mvp = MatrixMul(MatrixMul(rlGetMatrixTransform(), rlGetMatrixModelview()),
+                           rlGetMatrixProjection());
+    int textureSlot = 0;
+
+    rlEnableShader(instanceShader.id);
+    rlSetUniformMatrix(mvpLoc, mvp);
+    rlSetUniform(textureLoc, &textureSlot, RL_SHADER_UNIFORM_INT, 1);
+
+    rlActiveTextureSlot(0);
+    rlEnableTexture(textureId ? textureId : rlGetTextureIdDefault());
+
+    rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(streamVbo);
+
+    while (count > 0)
+    {
+        int chunk = (count > INSTANCE_BUFFER_CAPACITY) ? INSTANCE_BUFFER_CAPACITY : count;
+        if (streamCursor + chunk > INSTANCE_BUFFER_CAPACITY) OrphanStreamBuffer();
+
+        size_t base = (size_t)streamCursor * sizeof(InstanceData);
+        rlUpdateVertexBuffer(streamVbo, instances, chunk * (int)sizeof(InstanceData), (int)base);
+        SetInstanceAttributes(base);
+
+        if (mesh.indices) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount * 3, 0, chunk);
+        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, chunk);
+
+        streamCursor += chunk;
+        instances += chunk;
+        count -= chunk;
+    }
+
+    for (int i = 0; i < 4; i++) rlDisableVertexAttribute(transformLoc + i);
+    rlDisableVertexAttribute(colorLoc);
+    rlDisableVertexAttribute(uvRectLoc);
+
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
+    rlDisableTexture();
+    rlDisableShader();
+}
@@ -0,0 +1,33 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Instanced Drawing Module
+//==================================================================
+
+#ifndef INSTANCING_H
+#define INSTANCING_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define INSTANCE_BUFFER_CAPACITY 4096
+
+typedef struct
+{
+    float transform[16];
+    Color color;
+    float uvRect[4];                // x, y, w, h applied to the mesh UVs
+} InstanceData;
+
+bool InitInstancing();
+void CloseInstancing();
+bool IsInstancingSupported();
+
+InstanceData MakeInstance(Vector3 position, Vector3 scale, Color color);
+
+// One draw call per INSTANCE_BUFFER_CAPACITY instances; falls back to a
+// DrawMesh per instance when the GL version has no instancing.
+void DrawInstances(Mesh mesh, unsigned int textureId, const InstanceData* instances, int count);
+
+#endif
@@ -0,0 +1,674 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Clustered Lighting Implementation
+//==================================================================
+
+#include "lights.h"
+#include "vector_math.h"
+#include "rlgl.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+// Every x86-64 compiler has SSE2; elsewhere the cluster test stays scalar
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define LIGHT_CLUSTER_SSE 1
+#else
+    #define LIGHT_CLUSTER_SSE 0
+#endif
+
+#define LIGHT_CANDIDATE_CAPACITY ((MAX_LIGHTS + 3) & ~3)   // whole groups of four
+
+typedef enum
+{
+    LIGHT_UNIFORM_ACTIVE,
+    LIGHT_UNIFORM_DATA,
+    LIGHT_UNIFORM_CLUSTERS,
+    LIGHT_UNIFORM_INDICES,
+    LIGHT_UNIFORM_VIEW_PROJ,
+    LIGHT_UNIFORM_EYE,
+    LIGHT_UNIFORM_PARAMS,
+    LIGHT_UNIFORM_COUNT
+} LightUniform;
+
+static const char* lightUniformNames[LIGHT_UNIFORM_COUNT] = {
+    "lightCount", "lightData", "lightClusters", "lightIndices",
+    "clusterViewProj", "clusterEye", "clusterParams"
+};
+
+typedef struct
+{
+    Shader shader;
+    int locs[LIGHT_UNIFORM_COUNT];
+} LightShader;
+
+static Light lights[MAX_LIGHTS];
+static int lightHighWater = 0;
+
+static LightingSettings lightingSettings = {
+    .enabled = true,
+    .clusterNear = 0.5f,
+    .clusterFar = 150.0f,
+    .specularStrength = 0.25f,
+    .shininess = 32.0f
+};
+static LightingStats lightingStats = {0};
+
+static LightShader lightShaders[MAX_LIGHT_SHADERS];
+static int lightShaderCount = 0;
+
+// Visible lights in view space, structure of arrays for the cluster tests
+static float viewX[MAX_LIGHTS];
+static float viewY[MAX_LIGHTS];
+static float viewZ[MAX_LIGHTS];
+static float viewRadius[MAX_LIGHTS];
+static int visibleLights[MAX_LIGHTS];
+static int visibleCount = 0;
+
+static float sliceDepth[LIGHT_CLUSTER_Z + 1];
+static float tanHalfX = 1.0f;
+static float tanHalfY = 1.0f;
+
+static unsigned short clusterLights[LIGHT_CLUSTER_COUNT][MAX_LIGHTS_PER_CLUSTER];
+static int clusterCounts[LIGHT_CLUSTER_COUNT];
+static int sliceOverflow[LIGHT_CLUSTER_Z];
+
+static float lightData[MAX_LIGHTS * 3 * 4];
+static float clusterData[LIGHT_CLUSTER_COUNT * 4];
+static float indexData[MAX_LIGHT_INDICES];
+
+static unsigned int dataTexture = 0;
+static unsigned int clusterTexture = 0;
+static unsigned int indexTexture = 0;
+static bool texturesReady = false;
+static bool texturesTried = false;
+static bool lightsBound = false;
+
+static pthread_t workers[LIGHT_CLUSTER_WORKERS];
+static pthread_mutex_t jobLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobReady = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t jobDone = PTHREAD_COND_INITIALIZER;
+static unsigned int jobGeneration = 0;
+static int nextSlice = LIGHT_CLUSTER_Z;
+static int workersBusy = 0;
+static int workerCount = 0;
+static bool stopWorkers = false;
+
+static int AddLight(Light light)
+{
+    for (int i = 0; i < MAX_LIGHTS; i++)
+    {
+        if (lights[i].active) continue;
+
+        light.active = true;
+        lights[i] = light;
+        if (i >= lightHighWater) lightHighWater = i + 1;
+        lightingStats.lights++;
+        return i;
+    }
+
+    printf("Warning: Maximum light limit reached!\n");
+    return -1;
+}
+
+int CreatePointLight(Vector3 position, Color color, float intensity, float range)
+{
+    Light light = {0};
+    light.type = LIGHT_POINT;
+    light.position = position;
+    light.color = color;
+    light.intensity = intensity;
+    light.range = range;
+    light.lifetime = -1.0f;
+    return AddLight(light);
+}
+
+int CreateSpotLight(Vector3 position, Vector3 direction, Color color, float intensity, float range,
+                    float innerAngle, float outerAngle)
+{
+    Light light = {0};
+    light.type = LIGHT_SPOT;
+    light.position = position;
+    light.direction = Vector3Normalize(direction);
+    light.color = color;
+    light.intensity = intensity;
+    light.range = range;
+    light.innerAngle = innerAngle;
+    light.outerAngle = outerAngle;
+    light.lifetime = -1.0f;
+    return AddLight(light);
+}
+
+int SpawnLightFlash(Vector3 position, Color color, float intensity, float range, float duration)
+{
+    int id = CreatePointLight(position, color, intensity, range);
+    if (id >= 0)
+    {
+        lights[id].lifetime = duration;
+        lights[id].duration = duration;
+    }
+    return id;
+}
+
+Light* GetLight(int id)
+{
+    if (id < 0 || id >= MAX_LIGHTS || !lights[id].active) return NULL;
+    return &lights[id];
+}
+
+void RemoveLight(int id)
+{
+    if (!GetLight(id)) return;
+
+    lights[id].active = false;
+    lightingStats.lights--;
+    while (lightHighWater > 0 && !lights[lightHighWater - 1].active) lightHighWater--;
+}
+
+void ClearLights()
+{
+    for (int i = 0; i < lightHighWater; i++) lights[i].active = false;
+    lightHighWater = 0;
+    lightingStats.lights = 0;
+}
+
+void UpdateLights(float deltaTime)
+{
+    for (int i = 0; i < lightHighWater; i++)
+    {
+        Light* light = &lights[i];
+        if (!light->active || light->lifetime < 0.0f) continue;
+
+        light->lifetime -= deltaTime;
+        if (light->lifetime <= 0.0f) RemoveLight(i);
+    }
+}
+
+// View-space bounds of froxel (x, y) in a slice, from the tile's NDC edges
+// at the slice's near and far depth
+static void ClusterBounds(int x, int y, float d0, float d1, float* lo, float* hi)
+{
+    float nx0 = -1.0f + 2.0f * x / LIGHT_CLUSTER_X, nx1 = -1.0f + 2.0f * (x + 1) / LIGHT_CLUSTER_X;
+    float ny0 = -1.0f + 2.0f * y / LIGHT_CLUSTER_Y, ny1 = -1.0f + 2.0f * (y + 1) / LIGHT_CLUSTER_Y;
+
+    lo[0] = fminf(nx0 * d0, nx0 * d1) * tanHalfX;
+    hi[0] = fmaxf(nx1 * d0, nx1 * d1) * tanHalfX;
+    lo[1] = fminf(ny0 * d0, ny0 * d1) * tanHalfY;
+    hi[1] = fmaxf(ny1 * d0, ny1 * d1) * tanHalfY;
+    lo[2] = -d1;
+    hi[2] = -d0;
+}
+
+static void BuildSlice(int slice)
+{
+    float d0 = sliceDepth[slice];
+    float d1 = sliceDepth[slice + 1];
+    float cx[LIGHT_CANDIDATE_CAPACITY], cy[LIGHT_CANDIDATE_CAPACITY];
+    float cz[LIGHT_CANDIDATE_CAPACITY], cr2[LIGHT_CANDIDATE_CAPACITY];
+    unsigned short candidate[MAX_LIGHTS];
+    unsigned char hit[LIGHT_CANDIDATE_CAPACITY];
+    int candidates = 0;
+
+    sliceOverflow[slice] = 0;
+
+    for (int i = 0; i < visibleCount; i++)
+    {
+        float depth = -viewZ[i];
+        if (depth + viewRadius[i] < d0 || depth - viewRadius[i] > d1) continue;
+
+        cx[candidates] = viewX[i];
+        cy[candidates] = viewY[i];
+        cz[candidates] = viewZ[i];
+        cr2[candidates] = viewRadius[i] * viewRadius[i];
+        candidate[candidates++] = (unsigned short)i;
+    }
+
+    // Pad to a group of four with lanes whose negative radius never hits
+    int padded = (candidates + 3) & ~3;
+    for (int j = candidates; j < padded; j++)
+    {
+        cx[j] = cy[j] = cz[j] = 0.0f;
+        cr2[j] = -1.0f;
+    }
+
+    for (int y = 0; y < LIGHT_CLUSTER_Y; y++)
+    {
+        for (int x = 0; x < LIGHT_CLUSTER_X; x++)
+        {
+            int cluster = (slice * LIGHT_CLUSTER_Y + y) * LIGHT_CLUSTER_X + x;
+            float lo[3], hi[3];
+            int count = 0;
+
+            ClusterBounds(x, y, d0, d1, lo, hi);
+
+            // Sphere against box, four candidates at a time. Written out
+            // because gcc won't if-convert fmaxf or a float ternary under
+            // the default -ftrapping-math, so the plain loop stays scalar.
+#if LIGHT_CLUSTER_SSE
+            __m128 zero = _mm_setzero_ps();
+            __m128 lox = _mm_set1_ps(lo[0]), loy = _mm_set1_ps(lo[1]), loz = _mm_set1_ps(lo[2]);
+            __m128 hix = _mm_set1_ps(hi[0]), hiy = _mm_set1_ps(hi[1]), hiz = _mm_set1_ps(hi[2]);
+
+            for (int j = 0; j < padded; j += 4)
+            {
+                __m128 px = _mm_loadu_ps(&cx[j]), py = _mm_loadu_ps(&cy[j]), pz = _mm_loadu_ps(&cz[j]);
+                __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(lox, px), _mm_sub_ps(px, hix)), zero);
+                __m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(loy, py), _mm_sub_ps(py, hiy)), zero);
+                __m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(loz, pz), _mm_sub_ps(pz, hiz)), zero);
+                __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                int mask = _mm_movemask_ps(_mm_cmple_ps(d2, _mm_loadu_ps(&cr2[j])));
+
+                hit[j] = mask & 1;
+                hit[j + 1] = (mask >> 1) & 1;
+                hit[j + 2] = (mask >> 2) & 1;
+                hit[j + 3] = (mask >> 3) & 1;
+            }
+#else
+            for (int j = 0; j < candidates; j++)
+            {
+                float dx = fmaxf(fmaxf(lo[0] - cx[j], cx[j] - hi[0]), 0.0f);
+                float dy = fmaxf(fmaxf(lo[1] - cy[j], cy[j] - hi[1]), 0.0f);
+                float dz = fmaxf(fmaxf(lo[2] - cz[j], cz[j] - hi[2]), 0.0f);
+                hit[j] = (dx*dx + dy*dy + dz*dz <= cr2[j]);
+            }
+#endif
+
+            for (int j = 0; j < candidates; j++)
+            {
+                if (!hit[j]) continue;
+                if (count < MAX_LIGHTS_PER_CLUSTER) clusterLights[cluster][count++] = candidate[j];
+                else sliceOverflow[slice]++;
+            }
+            clusterCounts[cluster] = count;
+        }
+    }
+}
+
+static void* ClusterWorkerMain(void* arg)
+{
+    unsigned int seen = 0;
+    (void)arg;
+
+    pthread_mutex_lock(&jobLock);
+    while (true)
+    {
+        while (!stopWorkers && jobGeneration == seen)
+        {
+            pthread_cond_wait(&jobReady, &jobLock);
+        }
+        if (stopWorkers) break;
+        seen = jobGeneration;
+
+        while (nextSlice < LIGHT_CLUSTER_Z)
+        {
+            int slice = nextSlice++;
+            pthread_mutex_unlock(&jobLock);
+            BuildSlice(slice);
+            pthread_mutex_lock(&jobLock);
+        }
+
+        if (--workersBusy == 0) pthread_cond_signal(&jobDone);
+    }
+    pthread_mutex_unlock(&jobLock);
+
+    return NULL;
+}
+
+static void StartClusterWorkers()
+{
+    stopWorkers = false;
+    jobGeneration = 0;
+
+    for (workerCount = 0; workerCount < LIGHT_CLUSTER_WORKERS; workerCount++)
+    {
+        if (pthread_create(&workers[workerCount], NULL, ClusterWorkerMain, NULL) != 0) break;
+    }
+
+    if (workerCount == 0) printf("Warning: Failed to start light cluster workers, building inline\n");
+}
+
+static void StopClusterWorkers()
+{
+    if (workerCount == 0) return;
+
+    pthread_mutex_lock(&jobLock);
+    stopWorkers = true;
+    pthread_cond_broadcast(&jobReady);
+    pthread_mutex_unlock(&jobLock);
+
+    for (int i = 0; i < workerCount; i++) pthread_join(workers[i], NULL);
+    workerCount = 0;
+}
+
+// Slices are handed out one at a time; the main thread takes them too
+static void BuildClusters()
+{
+    lightingStats.parallel = visibleCount >= LIGHT_PARALLEL_THRESHOLD;
+    if (lightingStats.parallel && workerCount == 0) StartClusterWorkers();
+
+    if (!lightingStats.parallel || workerCount == 0)
+    {
+        for (int slice = 0; slice < LIGHT_CLUSTER_Z; slice++) BuildSlice(slice);
+        return;
+    }
+
+    pthread_mutex_lock(&jobLock);
+    nextSlice = 0;
+    workersBusy = workerCount;
+    jobGeneration++;
+    pthread_cond_broadcast(&jobReady);
+
+    while (nextSlice < LIGHT_CLUSTER_Z)
+    {
+        int slice = nextSlice++;
+        pthread_mutex_unlock(&jobLock);
+        BuildSlice(slice);
+        pthread_mutex_lock(&jobLock);
+    }
+    while (workersBusy > 0)
+    {
+        pthread_cond_wait(&jobDone, &jobLock);
+    }
+    pthread_mutex_unlock(&jobLock);
+}
+
+static bool LoadLightTextures()
+{
+    if (texturesTried) return texturesReady;
+    texturesTried = true;
+
+    // Float textures and texelFetch need GL 3.3
+    if (rlGetVersion() < RL_OPENGL_33)
+    {
+        printf("Clustered lighting not supported by this GL version\n");
+        return false;
+    }
+
+    dataTexture = rlLoadTexture(NULL, 3, MAX_LIGHTS, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+    clusterTexture = rlLoadTexture(NULL, LIGHT_CLUSTER_X * LIGHT_CLUSTER_Y, LIGHT_CLUSTER_Z,
+                                   PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+    indexTexture = rlLoadTexture(NULL, LIGHT_INDEX_WIDTH, MAX_LIGHT_INDICES / LIGHT_INDEX_WIDTH,
+                                 PIXELFORMAT_UNCOMPRESSED_R32, 1);
+
+    texturesReady = dataTexture != 0 && clusterTexture != 0 && indexTexture != 0;
+    if (!texturesReady) printf("Warning: Failed to create light cluster textures\n");
+    return texturesReady;
+}
+
+// World position to view space with a raylib (column-major) matrix
+static Vector3 TransformPoint(Matrix m, Vector3 p)
+{
+    return (Vector3){
+        m.m0 * p.x + m.m4 * p.y + m.m8 * p.z + m.m12,
+        m.m1 * p.x + m.m5 * p.y + m.m9 * p.z + m.m13,
+        m.m2 * p.x + m.m6 * p.y + m.m10 * p.z + m.m14
+    };
+}
+
+static void GatherVisibleLights(Matrix view, const Light* frameLights, int frameLightCount)
+{
+    float nearDepth = lightingSettings.clusterNear;
+    float farDepth = lightingSettings.clusterFar;
+
+    visibleCount = 0;
+    for (int i = 0; i < frameLightCount; i++)
+    {
+        const Light* light = &frameLights[i];
+        if (!light->active || light->intensity <= 0.0f || light->range <= 0.0f) continue;
+
+        Vector3 p = TransformPoint(view, light->position);
+        if (-p.z + light->range < nearDepth || -p.z - light->range > farDepth) continue;
+
+        viewX[visibleCount] = p.x;
+        viewY[visibleCount] = p.y;
+        viewZ[visibleCount] = p.z;
+        viewRadius[visibleCount] = light->range;
+        visibleLights[visibleCount++] = i;
+    }
+}
+
+static void PackLightData(const Light* frameLights)
+{
+    for (int i = 0; i < visibleCount; i++)
+    {
+        const Light* light = &frameLights[visibleLights[i]];
+        float* texel = &lightData[i * 12];
+        float scale = light->intensity / 255.0f;
+
+        // Flashes fade out over their duration
+        if (light->lifetime >= 0.0f && light->duration > 0.0f) scale *= light->lifetime / light->duration;
+
+        texel[0] = light->position.x;
+        texel[1] = light->position.y;
+        texel[2] = light->position.z;
+        texel[3] = light->range;
+        texel[4] = light->color.r * scale;
+        texel[5] = light->color.g * scale;
+        texel[6] = light->color.b * scale;
+        texel[7] = -1.5f;
+        texel[8] = light->direction.x;
+        texel[9] = light->direction.y;
+        texel[10] = light->direction.z;
+        texel[11] = -2.0f;                  // below -1: no cone
+
+        if (light->type == LIGHT_SPOT)
+        {
+            texel[7] = cosf(light->innerAngle * DEG2RAD);
+            texel[11] = cosf(light->outerAngle * DEG2RAD);
+        }
+    }
+}
+
+// Per-cluster fixed lists into one list with (offset, count) per cluster
+static int PackClusterData()
+{
+    int total = 0;
+
+    lightingStats.occupiedClusters = 0;
+    lightingStats.overflows = 0;
+    for (int slice = 0; slice < LIGHT_CLUSTER_Z; slice++) lightingStats.overflows += sliceOverflow[slice];
+
+    for (int c = 0; c < LIGHT_CLUSTER_COUNT; c++)
+    {
+        int count = clusterCounts[c];
+        if (total + count > MAX_LIGHT_INDICES)
+        {
+            lightingStats.overflows += count - (MAX_LIGHT_INDICES - total);
+            count = MAX_LIGHT_INDICES - total;
+        }
+
+        clusterData[c * 4 + 0] = (float)total;
+        clusterData[c * 4 + 1] = (float)count;
+        for (int j = 0; j < count; j++) indexData[total++] = clusterLights[c][j];
+        if (count > 0) lightingStats.occupiedClusters++;
+    }
+
+    return total;
+}
+
+static void SetLightUniforms(int count, Matrix viewProj, Vector3 eye)
+{
+    float eyeValue[3] = { eye.x, eye.y, eye.z };
+    float params[4] = {
+        lightingSettings.clusterNear,
+        logf(lightingSettings.clusterFar / lightingSettings.clusterNear),
+        lightingSettings.specularStrength,
+        lightingSettings.shininess
+    };
+
+    for (int i = 0; i < lightShaderCount; i++)
+    {
+        LightShader* lightShader = &lightShaders[i];
+        Shader shader = lightShader->shader;
+
+        SetShaderValue(shader, lightShader->locs[LIGHT_UNIFORM_ACTIVE], &count, SHADER_UNIFORM_INT);
+        if (count == 0) continue;
+
+        SetShaderValueMatrix(shader, lightShader->locs[LIGHT_UNIFORM_VIEW_PROJ], viewProj);
+        SetShaderValue(shader, lightShader->locs[LIGHT_UNIFORM_EYE], eyeValue, SHADER_UNIFORM_VEC3);
+        SetShaderValue(shader, lightShader->locs[LIGHT_UNIFORM_PARAMS], params, SHADER_UNIFORM_VEC4);
+    }
+}
+
+int CopyLights(Light* out)
+{
+    memcpy(out, lights, (size_t)lightHighWater * sizeof(Light));
+    return lightHighWater;
+}
+
+void BindLights(const Light* frameLights, int frameLightCount)
+{
+    Matrix view = rlGetMatrixModelview();
+    Matrix projection = rlGetMatrixProjection();
+    double start = GetTime();
+
+    lightingStats.visibleLights = 0;
+    lightingStats.indices = 0;
+
+    // Orthographic cameras have no depth slices to bin into
+    bool usable = lightingSettings.enabled && lightShaderCount > 0 && frameLightCount > 0 &&
+                  projection.m11 < -0.5f && lightingSettings.clusterFar > lightingSettings.clusterNear &&
+                  lightingSettings.clusterNear > 0.0f && LoadLightTextures();
+    if (usable) GatherVisibleLights(view, frameLights, frameLightCount);
+
+    if (!usable || visibleCount == 0)
+    {
+        SetLightUniforms(0, view, (Vector3){0});
+        return;
+    }
+
+    tanHalfX = 1.0f / projection.m0;
+    tanHalfY = 1.0f / projection.m5;
+    for (int slice = 0; slice <= LIGHT_CLUSTER_Z; slice++)
+    {
+        sliceDepth[slice] = lightingSettings.clusterNear *
+                            powf(lightingSettings.clusterFar / lightingSettings.clusterNear, (float)slice / LIGHT_CLUSTER_Z);
+    }
+
+    BuildClusters();
+    PackLightData(frameLights);
+    int indices = PackClusterData();
+
+    rlUpdateTexture(dataTexture, 0, 0, 3, visibleCount, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, lightData);
+    rlUpdateTexture(clusterTexture, 0, 0, LIGHT_CLUSTER_X * LIGHT_CLUSTER_Y, LIGHT_CLUSTER_Z,
+                    PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, clusterData);
+    if (indices > 0)
+    {
+        int rows = (indices + LIGHT_INDEX_WIDTH - 1) / LIGHT_INDEX_WIDTH;
+        rlUpdateTexture(indexTexture, 0, 0, LIGHT_INDEX_WIDTH, rows, PIXELFORMAT_UNCOMPRESSED_R32, indexData);
+    }
+
+    // Rigid view matrix: the eye is -R^T t
+    Vector3 eye = {
+        -(view.m0 * view.m12 + view.m1 * view.m13 + view.m2 * view.m14),
+        -(view.m4 * view.m12 + view.m5 * view.m13 + view.m6 * view.m14),
+        -(view.m8 * view.m12 + view.m9 * view.m13 + view.m10 * view.m14)
+    };
+    SetLightUniforms(visibleCount, MatrixMul(view, projection), eye);
+
+    rlActiveTextureSlot(LIGHT_DATA_TEXTURE_SLOT);
+    rlEnableTexture(dataTexture);
+    rlActiveTextureSlot(LIGHT_CLUSTER_TEXTURE_SLOT);
+    rlEnableTexture(clusterTexture);
+    rlActiveTextureSlot(LIGHT_INDEX_TEXTURE_SLOT);
+    rlEnableTexture(indexTexture);
+    rlActiveTextureSlot(0);
+    lightsBound = true;
+
+    lightingStats.visibleLights = visibleCount;
+    lightingStats.indices = indices;
+    lightingStats.buildMs = (float)((GetTime() - start) * 1000.0);
+}
+
+void UnbindLights()
+{
+    if (!lightsBound) return;
+
+    for (int slot = LIGHT_DATA_TEXTURE_SLOT; slot <= LIGHT_INDEX_TEXTURE_SLOT; slot++)
+    {
+        rlActiveTextureSlot(slot);
+        rlDisableTexture();
+    }
+    rlActiveTextureSlot(0);
+    lightsBound = false;
+
+    // As with the shadow map: later draws must not read the unbound textures
+    SetLightUniforms(0, (Matrix){0}, (Vector3){0});
+}
+
+bool RegisterLightShader(Shader shader)
+{
+    if (shader.id == 0 || shader.id == rlGetShaderIdDefault()) return false;
+
+    for (int i = 0; i < lightShaderCount; i++)
+    {
+        if (lightShaders[i].shader.id == shader.id) return true;
+    }
+
+    if (lightShaderCount >= MAX_LIGHT_SHADERS)
+    {
+        printf("Warning: Too many light shaders, shader %u won't receive lights\n", shader.id);
+        return false;
+    }
+
+    LightShader* lightShader = &lightShaders[lightShaderCount++];
+    lightShader->shader = shader;
+    for (int u = 0; u < LIGHT_UNIFORM_COUNT; u++)
+    {
+        lightShader->locs[u] = GetShaderLocation(shader, lightUniformNames[u]);
+    }
+
+    int slots[3] = { LIGHT_DATA_TEXTURE_SLOT, LIGHT_CLUSTER_TEXTURE_SLOT, LIGHT_INDEX_TEXTURE_SLOT };
+    int count = 0;
+    SetShaderValue(shader, lightShader->locs[LIGHT_UNIFORM_DATA], &slots[0], SHADER_UNIFORM_INT);
+    SetShaderValue(shader, lightShader->locs[LIGHT_UNIFORM_CLUSTERS], &slots[1], SHADER_UNIFORM_INT);
+    SetShaderValue(shader, lightShader->locs[LIGHT_UNIFORM_INDICES], &slots[2], SHADER_UNIFORM_INT);
+    SetShaderValue(shader, lightShader->locs[LIGHT_UNIFORM_ACTIVE], &count, SHADER_UNIFORM_INT);
+    return true;
+}
+
+void UnregisterLightShader(Shader shader)
+{
+    for (int i = 0; i < lightShaderCount; i++)
+    {
+        if (lightShaders[i].shader.id != shader.id) continue;
+
+        lightShaders[i] = lightShaders[--lightShaderCount];
+        return;
+    }
+}
+
+void CloseLights()
+{
+    StopClusterWorkers();
+    UnbindLights();
+
+    if (dataTexture) rlUnloadTexture(dataTexture);
+    if (clusterTexture) rlUnloadTexture(clusterTexture);
+    if (indexTexture) rlUnloadTexture(indexTexture);
+
+    dataTexture = clusterTexture = indexTexture = 0;
+    texturesReady = false;
+    texturesTried = false;
+    ClearLights();
+}
+
+void SetLightingEnabled(bool enabled)
+{
+    lightingSettings.enabled = enabled;
+    printf("Clustered lighting %s\n", enabled ? "enabled" : "disabled");
+}
+
+LightingSettings* GetLightingSettings()
+{
+    return &lightingSettings;
+}
+
+LightingStats* GetLightingStats()
+{
+    return &lightingStats;
+}
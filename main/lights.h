@@ -0,0 +1,142 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Clustered Lighting Module
+//==================================================================
+
+#ifndef LIGHTS_H
+#define LIGHTS_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define MAX_LIGHTS 1024
+#define LIGHT_CLUSTER_X 16
+#define LIGHT_CLUSTER_Y 9
+#define LIGHT_CLUSTER_Z 24               // exponential depth slices
+#define LIGHT_CLUSTER_COUNT (LIGHT_CLUSTER_X * LIGHT_CLUSTER_Y * LIGHT_CLUSTER_Z)
+#define MAX_LIGHTS_PER_CLUSTER 64
+#define LIGHT_INDEX_WIDTH 1024
+#define MAX_LIGHT_INDICES (LIGHT_INDEX_WIDTH * 64)
+#define LIGHT_CLUSTER_WORKERS 3
+#define LIGHT_PARALLEL_THRESHOLD 32      // fewer visible lights build inline
+
+#define LIGHT_DATA_TEXTURE_SLOT 4
+#define LIGHT_CLUSTER_TEXTURE_SLOT 5
+#define LIGHT_INDEX_TEXTURE_SLOT 6
+#define MAX_LIGHT_SHADERS 8
+
+#define LIGHT_GLSL_INT(value) LIGHT_GLSL_STR(value)
+#define LIGHT_GLSL_STR(value) #value
+
+// GLSL 330 cluster lookup. ClusterLighting(worldPosition, normal, albedo)
+// returns the light to add from the point and spot lights in the
+// fragment's cluster. Shaders that use it are kept up to date after
+// RegisterLightShader.
+#define LIGHT_SHADER_GLSL \
+    "uniform int lightCount;\n" \
+    "uniform sampler2D lightData, lightClusters, lightIndices;\n" \
+    "uniform mat4 clusterViewProj;\n" \
+    "uniform vec3 clusterEye;\n" \
+    "uniform vec4 clusterParams;\n" \
+    "vec3 ClusterLighting(vec3 position, vec3 normal, vec3 albedo)\n" \
+    "{\n" \
+    "    if (lightCount == 0) return vec3(0.0);\n" \
+    "    vec4 clip = clusterViewProj*vec4(position, 1.0);\n" \
+    "    if (clip.w <= 0.0) return vec3(0.0);\n" \
+    "    vec2 tile = clamp((clip.xy/clip.w)*0.5 + 0.5, 0.0, 0.9999)*vec2(" LIGHT_GLSL_INT(LIGHT_CLUSTER_X) ", " LIGHT_GLSL_INT(LIGHT_CLUSTER_Y) ");\n" \
+    "    float slice = log(max(clip.w, clusterParams.x)/clusterParams.x)/clusterParams.y*" LIGHT_GLSL_INT(LIGHT_CLUSTER_Z) ".0;\n" \
+    "    ivec2 cell = ivec2(int(tile.y)*" LIGHT_GLSL_INT(LIGHT_CLUSTER_X) " + int(tile.x), min(int(slice), " LIGHT_GLSL_INT(LIGHT_CLUSTER_Z) " - 1));\n" \
+    "    ivec2 range = ivec2(texelFetch(lightClusters, cell, 0).xy);\n" \
+    "    vec3 n = normalize(normal);\n" \
+    "    vec3 v = normalize(clusterEye - position);\n" \
+    "    vec3 total = vec3(0.0);\n" \
+    "    for (int entry = range.x; entry < range.x + range.y; entry++)\n" \
+    "    {\n" \
+    "        int index = int(texelFetch(lightIndices, ivec2(entry % " LIGHT_GLSL_INT(LIGHT_INDEX_WIDTH) ", entry / " LIGHT_GLSL_INT(LIGHT_INDEX_WIDTH) "), 0).r);\n" \
+    "        vec4 p = texelFetch(lightData, ivec2(0, index), 0);\n" \
+    "        vec4 c = texelFetch(lightData, ivec2(1, index), 0);\n" \
+    "        vec4 s = texelFetch(lightData, ivec2(2, index), 0);\n" \
+    "        vec3 toLight = p.xyz - position;\n" \
+    "        float d2 = dot(toLight, toLight);\n" \
+    "        float window = clamp(1.0 - d2*d2/(p.w*p.w*p.w*p.w), 0.0, 1.0);\n" \
+    "        vec3 l = toLight*inversesqrt(max(d2, 0.0001));\n" \
+    "        float cone = (s.w < -1.0) ? 1.0 : smoothstep(s.w, c.w, dot(-l, s.xyz));\n" \
+    "        float attenuation = window*window*cone/(d2 + 1.0);\n" \
+    "        float diffuse = max(dot(n, l), 0.0);\n" \
+    "        float specular = (diffuse > 0.0) ? pow(max(dot(n, normalize(l + v)), 0.0), clusterParams.w)*clusterParams.z : 0.0;\n" \
+    "        total += c.rgb*attenuation*(albedo*diffuse + specular);\n" \
+    "    }\n" \
+    "    return total;\n" \
+    "}\n"
+
+typedef enum
+{
+    LIGHT_POINT,
+    LIGHT_SPOT
+} LightType;
+
+typedef struct
+{
+    bool active;
+    LightType type;
+    Vector3 position;
+    Vector3 direction;              // spot axis, normalized
+    Color color;
+    float intensity;
+    float range;                    // no contribution past this distance
+    float innerAngle;               // spot cone, degrees from the axis
+    float outerAngle;
+    float lifetime;                 // seconds left for flashes, < 0 = permanent
+    float duration;
+} Light;
+
+typedef struct
+{
+    bool enabled;
+    float clusterNear;
+    float clusterFar;               // lights past this aren't clustered
+    float specularStrength;
+    float shininess;
+} LightingSettings;
+
+typedef struct
+{
+    int lights;
+    int visibleLights;
+    int occupiedClusters;
+    int indices;
+    int overflows;                  // lights dropped from full clusters
+    bool parallel;
+    float buildMs;
+} LightingStats;
+
+// Handles are stable until the light is removed or, for flashes, fades out
+int CreatePointLight(Vector3 position, Color color, float intensity, float range);
+int CreateSpotLight(Vector3 position, Vector3 direction, Color color, float intensity, float range,
+                    float innerAngle, float outerAngle);
+int SpawnLightFlash(Vector3 position, Color color, float intensity, float range, float duration);
+Light* GetLight(int id);
+void RemoveLight(int id);
+void ClearLights();
+void UpdateLights(float deltaTime);
+
+// Copies the used part of the light table for a frame drawn later and
+// returns how many entries it wrote, at most MAX_LIGHTS
+int CopyLights(Light* out);
+
+// Call inside BeginMode3D: bins a frame's visible lights into view-space
+// clusters (on worker threads once there are enough of them), uploads the
+// lists and binds them for every registered shader until UnbindLights
+void BindLights(const Light* frameLights, int frameLightCount);
+void UnbindLights();
+bool RegisterLightShader(Shader shader);
+void UnregisterLightShader(Shader shader);
+void CloseLights();
+
+void SetLightingEnabled(bool enabled);
+LightingSettings* GetLightingSettings();
+LightingStats* GetLightingStats();
+
+#endif
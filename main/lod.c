@@ -0,0 +1,66 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Level Of Detail Implementation
+//==================================================================
+
+#include "lod.h"
+#include <math.h>
+
+static LodSettings lodSettings = {
+    .enabled = true,
+    .screenRadius = {120.0f, 50.0f, 18.0f},
+    .hysteresis = 0.15f
+};
+
+float GetProjectedRadius(Vector3 center, float radius, Camera3D camera, float viewHeight)
+{
+    float dx = center.x - camera.position.x;
+    float dy = center.y - camera.position.y;
+    float dz = center.z - camera.position.z;
+    float distance = sqrtf(dx*dx + dy*dy + dz*dz);
+
+    // Inside the sphere: as big as it gets
+    if (distance <= radius) return viewHeight;
+
+    if (camera.projection == CAMERA_ORTHOGRAPHIC)
+    {
+        return radius / (camera.fovy * 0.5f) * (viewHeight * 0.5f);
+    }
+
+    float halfFov = tanf(camera.fovy * 0.5f * DEG2RAD);
+    return radius / (distance * halfFov) * (viewHeight * 0.5f);
+}
+
+int UpdateObjectLod(GameObject* obj, Vector3 center, float radius, Camera3D camera, float viewHeight)
+{
+    if (!lodSettings.enabled)
+    {
+        obj->lodLevel = 0;
+        return 0;
+    }
+
+    float pixels = GetProjectedRadius(center, radius, camera, viewHeight);
+    int lod = obj->lodLevel;
+    if (lod < 0 || lod >= MESH_LOD_COUNT) lod = 0;
+
+    // Step at most one level per frame in either direction
+    if (lod > 0 && pixels > lodSettings.screenRadius[lod - 1] * (1.0f + lodSettings.hysteresis))
+    {
+        lod--;
+    }
+    else if (lod < MESH_LOD_COUNT - 1 &&
+             pixels < lodSettings.screenRadius[lod] * (1.0f - lodSettings.hysteresis))
+    {
+        lod++;
+    }
+
+    obj->lodLevel = lod;
+    return lod;
+}
+
+LodSettings* GetLodSettings()
+{
+    return &lodSettings;
+}
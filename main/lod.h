@@ -0,0 +1,33 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Level Of Detail Module
+//==================================================================
+
+#ifndef LOD_H
+#define LOD_H
+
+#include "raylib.h"
+#include "objects.h"
+#include "mesh_cache.h"
+#include <stdbool.h>
+
+typedef struct
+{
+    bool enabled;
+    float screenRadius[MESH_LOD_COUNT - 1];   // pixels needed to stay at level i
+    float hysteresis;                         // fraction of a threshold to cross before switching
+} LodSettings;
+
+// Picks obj->lodLevel from the projected screen radius of its bounding
+// sphere, only switching once the radius clears a threshold by the
+// hysteresis margin so objects near a boundary don't flicker. viewHeight
+// is the frame's rendered height in pixels, so dynamic resolution lowers
+// detail along with the render scale.
+int UpdateObjectLod(GameObject* obj, Vector3 center, float radius, Camera3D camera, float viewHeight);
+float GetProjectedRadius(Vector3 center, float radius, Camera3D camera, float viewHeight);
+
+LodSettings* GetLodSettings();
+
+#endif
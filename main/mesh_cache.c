@@ -0,0 +1,152 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Mesh Cache Implementation
+//==================================================================
+
+#include "mesh_cache.h"
+#include "render.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+static Model cachedModels[MESH_PRIMITIVE_COUNT][MESH_LOD_COUNT];
+static bool cachedLoaded[MESH_PRIMITIVE_COUNT][MESH_LOD_COUNT] = {{0}};
+
+static Mesh quadMesh = {0};
+static bool quadLoaded = false;
+
+static const int lodSegments[MESH_LOD_COUNT] = {16, 12, 8, 5};
+
+int GetMeshLodSegments(int lod)
+{
+    if (lod < 0) lod = 0;
+    if (lod >= MESH_LOD_COUNT) lod = MESH_LOD_COUNT - 1;
+    return lodSegments[lod];
+}
+
+static Mesh GenPrimitiveMesh(MeshPrimitive primitive, int lod)
+{
+    int segments = GetMeshLodSegments(lod);
+
+    switch (primitive)
+    {
+        case MESH_SPHERE:   return GenMeshSphere(0.5f, segments, segments);
+        case MESH_CYLINDER: return GenMeshCylinder(0.5f, 1.0f, segments);
+        case MESH_CONE:     return GenMeshCone(0.5f, 1.0f, segments);
+        default:            return GenMeshCube(1.0f, 1.0f, 1.0f);
+    }
+}
+
+Model* GetCachedModel(MeshPrimitive primitive)
+{
+    return GetCachedModelLod(primitive, 0);
+}
+
+Model* GetCachedModelLod(MeshPrimitive primitive, int lod)
+{
+    if (primitive < 0 || primitive >= MESH_PRIMITIVE_COUNT) primitive = MESH_CUBE;
+    if (lod < 0 || lod >= MESH_LOD_COUNT || primitive == MESH_CUBE) lod = 0;
+
+    if (!cachedLoaded[primitive][lod])
+    {
+        cachedModels[primitive][lod] = LoadModelFromMesh(GenPrimitiveMesh(primitive, lod));
+        cachedModels[primitive][lod].materials[0].shader = GetRenderMeshShader();
+        cachedLoaded[primitive][lod] = true;
+        printf("Cached mesh for primitive %d LOD %d (%d triangles)\n",
+               primitive, lod, cachedModels[primitive][lod].meshes[0].triangleCount);
+    }
+
+    return &cachedModels[primitive][lod];
+}
+
+const Mesh* GetCachedQuadMesh()
+{
+    static const float corners[4][2] = { {-0.5f, -0.5f}, {0.5f, -0.5f}, {0.5f, 0.5f}, {-0.5f, 0.5f} };
+    static const unsigned short quadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+
+    if (quadLoaded) return &quadMesh;
+
+    quadMesh = (Mesh){0};
+    quadMesh.vertexCount = 4;
+    quadMesh.triangleCount = 2;
+    quadMesh.vertices = (float*)MemAlloc(4 * 3 * sizeof(float));
+    quadMesh.texcoords = (float*)MemAlloc(4 * 2 * sizeof(float));
+    quadMesh.normals = (float*)MemAlloc(4 * 3 * sizeof(float));
+    quadMesh.indices = (unsigned short*)MemAlloc(6 * sizeof(unsigned short));
+
+    for (int i = 0; i < 4; i++)
+    {
+        quadMesh.vertices[i * 3] = corners[i][0];
+        quadMesh.vertices[i * 3 + 1] = corners[i][1];
+        quadMesh.vertices[i * 3 + 2] = 0.0f;
+        quadMesh.texcoords[i * 2] = corners[i][0] + 0.5f;
+        quadMesh.texcoords[i * 2 + 1] = corners[i][1] + 0.5f;
+        quadMesh.normals[i * 3] = 0.0f;
+        quadMesh.normals[i * 3 + 1] = 0.0f;
+        quadMesh.normals[i * 3 + 2] = 1.0f;
+    }
+    for (int i = 0; i < 6; i++) quadMesh.indices[i] = quadIndices[i];
+
+    UploadMesh(&quadMesh, false);
+    quadLoaded = true;
+    return &quadMesh;
+}
+
+static void SetMapTexture(Material* material, int map, Texture2D texture)
+{
+    if (texture.id == 0)
+    {
+        // The default texture is the only one UnloadModel leaves alone
+        texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    }
+    material->maps[map].texture = texture;
+}
+
+void DrawCachedModel(MeshPrimitive primitive, Vector3 position, Vector3 size,
+                     Texture2D diffuse, Texture2D normal, Texture2D specular, Color tint)
+{
+    Model* model = GetCachedModel(primitive);
+    Material* material = &model->materials[0];
+
+    SetMapTexture(material, MATERIAL_MAP_DIFFUSE, diffuse);
+    SetMapTexture(material, MATERIAL_MAP_NORMAL, normal);
+    SetMapTexture(material, MATERIAL_MAP_SPECULAR, specular);
+
+    DrawModelEx(*model, position, (Vector3){0, 1, 0}, 0.0f, size, tint);
+
+    SetMapTexture(material, MATERIAL_MAP_DIFFUSE, (Texture2D){0});
+    SetMapTexture(material, MATERIAL_MAP_NORMAL, (Texture2D){0});
+    SetMapTexture(material, MATERIAL_MAP_SPECULAR, (Texture2D){0});
+}
+
+void LoadMeshCache()
+{
+    for (int primitive = 0; primitive < MESH_PRIMITIVE_COUNT; primitive++)
+    {
+        for (int lod = 0; lod < MESH_LOD_COUNT; lod++) GetCachedModelLod((MeshPrimitive)primitive, lod);
+    }
+    GetCachedQuadMesh();
+}
+
+void CloseMeshCache()
+{
+    for (int i = 0; i < MESH_PRIMITIVE_COUNT; i++)
+    {
+        for (int lod = 0; lod < MESH_LOD_COUNT; lod++)
+        {
+            if (cachedLoaded[i][lod])
+            {
+                // The mesh shader is shared, UnloadModel must leave it alone
+                cachedModels[i][lod].materials[0].shader.id = rlGetShaderIdDefault();
+                UnloadModel(cachedModels[i][lod]);
+                cachedLoaded[i][lod] = false;
+            }
+        }
+    }
+
+    if (quadLoaded) UnloadMesh(quadMesh);
+    quadMesh = (Mesh){0};
+    quadLoaded = false;
+}
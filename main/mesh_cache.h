@@ -0,0 +1,42 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Mesh Cache Module
+//==================================================================
+
+#ifndef MESH_CACHE_H
+#define MESH_CACHE_H
+
+#include "raylib.h"
+
+typedef enum
+{
+    MESH_CUBE,
+    MESH_SPHERE,
+    MESH_CYLINDER,
+    MESH_CONE,
+    MESH_PRIMITIVE_COUNT
+} MeshPrimitive;
+
+#define MESH_LOD_COUNT 4
+
+// Unit-sized primitives uploaded once and scaled per draw. Cylinders and
+// cones have their base at the origin, like DrawCylinder. Spheres,
+// cylinders and cones get one mesh per LOD level; cubes have only one.
+Model* GetCachedModel(MeshPrimitive primitive);
+Model* GetCachedModelLod(MeshPrimitive primitive, int lod);
+int GetMeshLodSegments(int lod);
+void DrawCachedModel(MeshPrimitive primitive, Vector3 position, Vector3 size,
+                     Texture2D diffuse, Texture2D normal, Texture2D specular, Color tint);
+
+// Unit quad centred on the origin in the XY plane, facing +Z, with v = 1
+// at the top edge: two triangles for camera-facing particles and impostors
+const Mesh* GetCachedQuadMesh();
+
+// Uploads every primitive, LOD and the quad now; afterwards the getters
+// above only read, so a recording thread may call them
+void LoadMeshCache();
+void CloseMeshCache();
+
+#endif
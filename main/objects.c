@@ -7,6 +7,13 @@
 
 #include "objects.h"
 #include "engine.h"
+#include "physics_thread.h"
+#include "mesh_cache.h"
+#include "instancing.h"
+#include "texture_atlas.h"
+#include "texture_loader.h"
+#include "debug_draw.h"
+#include "render_pipeline.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -34,7 +41,7 @@ Texture2D LoadGameTexture(const char* path, const char* textureName)
     }
     
     if (FileExists(path)) {
-        Texture2D tex = LoadTexture(path);
+        Texture2D tex = LoadTextureOptimized(path, NULL);
         strcpy(texturePool[textureCount].name, textureName);
         texturePool[textureCount].texture = tex;
         texturePool[textureCount].refCount = 1;
@@ -185,11 +192,57 @@ GameObject* CreateObject(ObjectType type, const char* name, float x, float y, fl
     }
     
     objects[(*objectCount)++] = obj;
+    RegisterPhysicsBody(obj);
     
     printf("Created object: %s at (%.1f, %.1f, %.1f)\n", obj->name, x, y, z);
     return obj;
 }
 
+// The uploaded pixels are also offered to the atlas, and instanced and
+// batched draws then sample the page. With atlasProxies set the full
+// upload is swapped for a single averaged texel whose id keeps the
+// mapping unique. Without instancing the per-object fallback can't offset
+// UVs and needs the standalone texture, so it is always kept.
+static Texture2D LoadDiffuseTexture(const char* path)
+{
+    Image image;
+    Texture2D tex = LoadTextureOptimized(path, &image);
+    if (tex.id == 0) return tex;
+
+    if (!IsInstancingSupported() || !GetTextureLoadSettings()->atlasProxies)
+    {
+        AddTextureToAtlas(path, image, tex.id);
+    }
+    else if (AddTextureToAtlas(path, image, 0))
+    {
+        Image texel = ImageCopy(image);
+        ImageResize(&texel, 1, 1);
+        Texture2D proxy = LoadTextureFromImage(texel);
+        UnloadImage(texel);
+
+        if (proxy.id != 0 && AddTextureToAtlas(path, image, proxy.id))
+        {
+            UnloadTexture(tex);
+            tex = proxy;
+        }
+        else if (proxy.id != 0)
+        {
+            UnloadTexture(proxy);
+        }
+    }
+
+    UnloadImage(image);
+    return tex;
+}
+
+// Frames still in the render pipeline may sample it, so it is retired
+// rather than unloaded; its atlas region is free for reuse at once
+static void UnloadDiffuseTexture(Texture2D tex)
+{
+    RemoveAtlasTexture(tex.id);
+    RetireTexture(tex);
+}
+
 void DestroyObject(GameObject* obj)
 {
     GameObject** objects = GetObjects();
@@ -199,15 +252,17 @@ void DestroyObject(GameObject* obj)
     {
         if (objects[i] == obj)
         {
+            UnregisterPhysicsBody(obj);
+            
             if (obj->hasTexture)
             {
-                UnloadTexture(obj->texture);
+                UnloadDiffuseTexture(obj->texture);
             }
 
             if (obj->hasMaterial)
             {
                 if (obj->material.diffuseMap.id != 0)
-                    UnloadTexture(obj->material.diffuseMap);
+                    UnloadDiffuseTexture(obj->material.diffuseMap);
                 if (obj->material.normalMap.id != 0)
                     UnloadTexture(obj->material.normalMap);
                 if (obj->material.specularMap.id != 0)
@@ -254,6 +309,7 @@ void SetObjectPosition(GameObject* obj, float x, float y, float z)
         obj->position.x = x;
         obj->position.y = y;
         obj->position.z = z;
+        QueuePhysicsPosition(obj);
     }
 }
 
@@ -285,9 +341,9 @@ void SetObjectTextureOld(GameObject* obj, const char* texturePath)
     {
         if (obj->hasTexture)
         {
-            UnloadTexture(obj->texture);
+            UnloadDiffuseTexture(obj->texture);
         }
-        obj->texture = LoadTexture(texturePath);
+        obj->texture = LoadDiffuseTexture(texturePath);
         obj->hasTexture = true;
         printf("Texture set for object: %s (old API)\n", obj->name);
     }
@@ -303,13 +359,13 @@ void SetObjectTexture(GameObject* obj, const char* texturePath, TextureType texT
     
     if (FileExists(texturePath))
     {
-        Texture2D tex = LoadTexture(texturePath);
+        Texture2D tex = (texType == TEX_DIFFUSE) ? LoadDiffuseTexture(texturePath) : LoadTextureOptimized(texturePath, NULL);
         
         switch (texType)
         {
             case TEX_DIFFUSE:
                 if (obj->material.diffuseMap.id != 0)
-                    UnloadTexture(obj->material.diffuseMap);
+                    UnloadDiffuseTexture(obj->material.diffuseMap);
                 obj->material.diffuseMap = tex;
                 break;
             case TEX_NORMAL:
@@ -599,6 +655,29 @@ GameObject* CreateConeEx(const char* name, float x, float y, float z,
     return cone;
 }
 
+void DrawObjectWireframe(const GameObject* obj)
+{
+    switch (obj->type)
+    {
+        case OBJ_CUBE:
+        case OBJ_PYRAMID:
+        case OBJ_PLANE:
+            DebugBox(obj->position, obj->size, obj->color);
+            break;
+        case OBJ_SPHERE:
+            DebugSphere(obj->position, obj->size.x / 2, GetMeshLodSegments(obj->lodLevel), obj->color);
+            break;
+        case OBJ_CYLINDER:
+        case OBJ_CONE:
+            DebugCylinder(obj->position, obj->size.x / 2, obj->size.x / 2, obj->size.y,
+                          GetMeshLodSegments(obj->lodLevel), obj->color);
+            break;
+        default:
+            DebugBox(obj->position, obj->size, obj->color);
+            break;
+    }
+}
+
 void DrawObject(GameObject* obj)
 {
     if (!obj || !obj->isVisible) return;
@@ -609,24 +688,7 @@ void DrawObject(GameObject* obj)
     
     if (*wireframeMode)
     {
-        switch (obj->type)
-        {
-            case OBJ_CUBE:
-            case OBJ_PYRAMID:
-            case OBJ_PLANE:
-                DrawCubeWires(obj->position, obj->size.x, obj->size.y, obj->size.z, obj->color);
-                break;
-            case OBJ_SPHERE:
-                DrawSphereWires(obj->position, obj->size.x / 2, 16, 16, obj->color);
-                break;
-            case OBJ_CYLINDER:
-            case OBJ_CONE:
-                DrawCylinderWires(obj->position, obj->size.x / 2, obj->size.x / 2, obj->size.y, 16, obj->color);
-                break;
-            default:
-                DrawCubeWires(obj->position, obj->size.x, obj->size.y, obj->size.z, obj->color);
-                break;
-        }
+        DrawObjectWireframe(obj);
     }
     else
     {
@@ -637,17 +699,11 @@ void DrawObject(GameObject* obj)
                 case OBJ_CUBE:
                 case OBJ_PLANE:
                     {
-                        Model model = LoadModelFromMesh(GenMeshCube(obj->size.x, obj->size.y, obj->size.z));
-                        model.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = obj->material.diffuseMap;
+                        Texture2D normal = obj->material.useNormalMap ? obj->material.normalMap : (Texture2D){0};
+                        Texture2D specular = obj->material.useSpecularMap ? obj->material.specularMap : (Texture2D){0};
                         
-                        if (obj->material.useNormalMap && obj->material.normalMap.id != 0)
-                            model.materials[0].maps[MATERIAL_MAP_NORMAL].texture = obj->material.normalMap;
-                        
-                        if (obj->material.useSpecularMap && obj->material.specularMap.id != 0)
-                            model.materials[0].maps[MATERIAL_MAP_SPECULAR].texture = obj->material.specularMap;
-
-                        DrawModel(model, obj->position, 1.0f, WHITE);
-                        UnloadModel(model);
+                        DrawCachedModel(MESH_CUBE, obj->position, obj->size,
+                                        obj->material.diffuseMap, normal, specular, WHITE);
                     }
                     break;
                 default:
@@ -677,12 +733,8 @@ void DrawObject(GameObject* obj)
             {
                 case OBJ_CUBE:
                 case OBJ_PLANE:
-                    {
-                        Model cubeModel = LoadModelFromMesh(GenMeshCube(obj->size.x, obj->size.y, obj->size.z));
-                        cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = obj->texture;
-                        DrawModel(cubeModel, obj->position, 1.0f, WHITE);
-                        UnloadModel(cubeModel);
-                    }
+                    DrawCachedModel(MESH_CUBE, obj->position, obj->size,
+                                    obj->texture, (Texture2D){0}, (Texture2D){0}, WHITE);
                     break;
                 default:
                     switch (obj->type)
@@ -736,9 +788,9 @@ void DrawObject(GameObject* obj)
             }
         }
         
-        if (obj->hasCollision)
+        if (obj->hasCollision && IsDebugDrawCategoryEnabled(DEBUG_DRAW_COLLIDERS))
         {
-            DrawCubeWires(obj->position, obj->size.x, obj->size.y, obj->size.z, BLACK);
+            DebugBox(obj->position, obj->size, BLACK);
         }
     }
 }
\ No newline at end of file
@@ -60,6 +60,7 @@ struct GameObject
     bool hasMaterial;
     
     bool isVisible;
+    int lodLevel;
     
     bool hasPhysics;
     PhysicsProperties physics;
@@ -89,6 +90,11 @@ void SetObjectScale(GameObject* obj, float sx, float sy, float sz);
 void SetObjectRotation(GameObject* obj, float rx, float ry, float rz);
 
 void SetObjectMaterial(GameObject* obj, ObjectMaterial material);
+// Small diffuse maps are also packed into the texture atlas. If
+// GetTextureLoadSettings()->atlasProxies is set (and instancing is
+// available) the object keeps only a 1x1 averaged texture: renderer draws
+// use the atlas, but DrawObject and code reading obj->texture or
+// material.diffuseMap see a flat colour.
 void SetObjectTexture(GameObject* obj, const char* texturePath, TextureType texType);
 void SetObjectColor(GameObject* obj, Color color);
 void SetObjectShininess(GameObject* obj, float shininess);
@@ -140,6 +146,8 @@ GameObject* CreateCone(const char* name, float x, float y, float z,
                        bool physics, bool collision, 
                        Color color, float radius, float height);
 
+// Wires go to the debug line buffer and draw at the next FlushDebugDraw
 void DrawObject(GameObject* obj);
+void DrawObjectWireframe(const GameObject* obj);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,330 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Software Occlusion Culling Implementation
+//==================================================================
+
+#include "occlusion.h"
+#include <math.h>
+#include <stdio.h>
+
+#define DEPTH_EMPTY 1.0f
+#define DEPTH_BIAS 0.0001f
+
+typedef struct
+{
+    float x, y, z, w;
+} ClipVertex;
+
+typedef struct
+{
+    int x0, y0, x1, y1;     // level 0 texels, inclusive
+} TexelRect;
+
+static float depthBuffer[OCCLUSION_WIDTH * OCCLUSION_HEIGHT];
+static float minDepth[OCCLUSION_LEVELS][OCCLUSION_WIDTH * OCCLUSION_HEIGHT / 4];
+static float maxDepth[OCCLUSION_LEVELS][OCCLUSION_WIDTH * OCCLUSION_HEIGHT / 4];
+
+static Matrix viewProj = {0};
+static bool occlusionReady = false;
+static OcclusionStats occlusionStats = { .enabled = true };
+
+static int LevelWidth(int level) { return OCCLUSION_WIDTH >> level; }
+static int LevelHeight(int level) { return OCCLUSION_HEIGHT >> level; }
+
+static const float* LevelData(int level, bool farthest)
+{
+    if (level == 0) return depthBuffer;
+    return farthest ? maxDepth[level] : minDepth[level];
+}
+
+static ClipVertex ToClip(Vector3 p)
+{
+    const Matrix* m = &viewProj;
+    return (ClipVertex){
+        m->m0*p.x + m->m4*p.y + m->m8*p.z + m->m12,
+        m->m1*p.x + m->m5*p.y + m->m9*p.z + m->m13,
+        m->m2*p.x + m->m6*p.y + m->m10*p.z + m->m14,
+        m->m3*p.x + m->m7*p.y + m->m11*p.z + m->m15
+    };
+}
+
+// Clip-space point to (texel x, texel y, NDC depth); y grows downward
+static void ToScreen(ClipVertex v, float* out)
+{
+    float invW = 1.0f / v.w;
+    out[0] = (v.x * invW * 0.5f + 0.5f) * OCCLUSION_WIDTH;
+    out[1] = (0.5f - v.y * invW * 0.5f) * OCCLUSION_HEIGHT;
+    out[2] = v.z * invW;
+}
+
+static void BoxCorners(Vector3 min, Vector3 max, Vector3* corners)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        corners[i] = (Vector3){ (i & 1) ? max.x : min.x, (i & 2) ? max.y : min.y, (i & 4) ? max.z : min.z };
+    }
+}
+
+void BeginOcclusionFrame(Matrix viewProjection)
+{
+    viewProj = viewProjection;
+    occlusionReady = false;
+    occlusionStats.occluders = 0;
+    occlusionStats.trianglesRasterized = 0;
+    occlusionStats.tested = 0;
+    occlusionStats.occluded = 0;
+
+    if (!occlusionStats.enabled) return;
+
+    for (int i = 0; i < OCCLUSION_WIDTH * OCCLUSION_HEIGHT; i++) depthBuffer[i] = DEPTH_EMPTY;
+}
+
+// Pixel-center coverage with incrementally stepped edge functions, keeping
+// the nearest depth per texel
+static void RasterizeTriangle(const float* a, const float* b, const float* c)
+{
+    float area = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+    if (fabsf(area) < 1e-8f) return;
+
+    int minX = (int)floorf(fminf(a[0], fminf(b[0], c[0])));
+    int maxX = (int)ceilf(fmaxf(a[0], fmaxf(b[0], c[0])));
+    int minY = (int)floorf(fminf(a[1], fminf(b[1], c[1])));
+    int maxY = (int)ceilf(fmaxf(a[1], fmaxf(b[1], c[1])));
+
+    if (minX < 0) minX = 0;
+    if (minY < 0) minY = 0;
+    if (maxX > OCCLUSION_WIDTH - 1) maxX = OCCLUSION_WIDTH - 1;
+    if (maxY > OCCLUSION_HEIGHT - 1) maxY = OCCLUSION_HEIGHT - 1;
+    if (minX > maxX || minY > maxY) return;
+
+    // Barycentric weights of b and c as affine functions of the pixel center
+    float invArea = 1.0f / area;
+    float w1dx = (c[1] - a[1]) * invArea, w1dy = (a[0] - c[0]) * invArea;
+    float w2dx = (a[1] - b[1]) * invArea, w2dy = (b[0] - a[0]) * invArea;
+    float px = minX + 0.5f, py = minY + 0.5f;
+    float w1Row = ((px - a[0]) * (c[1] - a[1]) - (py - a[1]) * (c[0] - a[0])) * invArea;
+    float w2Row = ((b[0] - a[0]) * (py - a[1]) - (b[1] - a[1]) * (px - a[0])) * invArea;
+    float dz1 = b[2] - a[2], dz2 = c[2] - a[2];
+
+    occlusionStats.trianglesRasterized++;
+
+    for (int y = minY; y <= maxY; y++)
+    {
+        float* row = &depthBuffer[y * OCCLUSION_WIDTH];
+        float w1 = w1Row, w2 = w2Row;
+
+        for (int x = minX; x <= maxX; x++)
+        {
+            if (w1 >= 0.0f && w2 >= 0.0f && w1 + w2 <= 1.0f)
+            {
+                float z = a[2] + w1 * dz1 + w2 * dz2;
+                if (z < row[x]) row[x] = z;
+            }
+            w1 += w1dx;
+            w2 += w2dx;
+        }
+
+        w1Row += w1dy;
+        w2Row += w2dy;
+    }
+}
+
+// Sutherland-Hodgman against the near plane (z + w >= 0), then fan
+static void RasterizeClipTriangle(ClipVertex a, ClipVertex b, ClipVertex c)
+{
+    ClipVertex in[3] = {a, b, c};
+    ClipVertex out[4];
+    int count = 0;
+
+    for (int i = 0; i < 3; i++)
+    {
+        ClipVertex p = in[i];
+        ClipVertex q = in[(i + 1) % 3];
+        float dp = p.z + p.w;
+        float dq = q.z + q.w;
+
+        if (dp >= 0.0f) out[count++] = p;
+        if ((dp >= 0.0f) != (dq >= 0.0f))
+        {
+            float t = dp / (dp - dq);
+            out[count++] = (ClipVertex){ p.x + (q.x - p.x) * t, p.y + (q.y - p.y) * t,
+                                         p.z + (q.z - p.z) * t, p.w + (q.w - p.w) * t };
+        }
+    }
+
+    if (count < 3) return;
+
+    float screen[4][3];
+    for (int i = 0; i < count; i++)
+    {
+        if (out[i].w <= 1e-6f) return;
+        ToScreen(out[i], screen[i]);
+    }
+
+    for (int i = 1; i + 1 < count; i++)
+    {
+        RasterizeTriangle(screen[0], screen[i], screen[i + 1]);
+    }
+}
+
+void RasterizeOccluderBox(Vector3 min, Vector3 max)
+{
+    static const int faces[6][4] = {
+        {0, 1, 3, 2}, {4, 6, 7, 5}, {0, 4, 5, 1},
+        {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 5, 7, 3}
+    };
+
+    if (!occlusionStats.enabled) return;
+
+    Vector3 corners[8];
+    ClipVertex clip[8];
+    BoxCorners(min, max, corners);
+    for (int i = 0; i < 8; i++) clip[i] = ToClip(corners[i]);
+
+    // Both windings are drawn, a closed box needs no facing test
+    for (int f = 0; f < 6; f++)
+    {
+        const int* q = faces[f];
+        RasterizeClipTriangle(clip[q[0]], clip[q[1]], clip[q[2]]);
+        RasterizeClipTriangle(clip[q[0]], clip[q[2]], clip[q[3]]);
+    }
+    occlusionStats.occluders++;
+}
+
+void FinishOcclusionFrame()
+{
+    if (!occlusionStats.enabled) return;
+
+    for (int level = 1; level < OCCLUSION_LEVELS; level++)
+    {
+        const float* srcMin = LevelData(level - 1, false);
+        const float* srcMax = LevelData(level - 1, true);
+        int srcWidth = LevelWidth(level - 1);
+        int width = LevelWidth(level);
+        int height = LevelHeight(level);
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                int s = (y * 2) * srcWidth + x * 2;
+
+                minDepth[level][y * width + x] = fminf(fminf(srcMin[s], srcMin[s + 1]),
+                                                       fminf(srcMin[s + srcWidth], srcMin[s + srcWidth + 1]));
+                maxDepth[level][y * width + x] = fmaxf(fmaxf(srcMax[s], srcMax[s + 1]),
+                                                       fmaxf(srcMax[s + srcWidth], srcMax[s + srcWidth + 1]));
+            }
+        }
+    }
+
+    occlusionReady = true;
+}
+
+// Hidden if every texel under the rect holds something nearer. The max
+// pyramid rejects whole tiles, the min pyramid accepts them early.
+static bool TileVisible(int level, int tx, int ty, const TexelRect* rect, float nearest)
+{
+    int width = LevelWidth(level);
+    if (nearest > LevelData(level, true)[ty * width + tx] + DEPTH_BIAS) return false;
+    if (level == 0 || nearest <= LevelData(level, false)[ty * width + tx]) return true;
+
+    int child = level - 1;
+    for (int cy = ty * 2; cy <= ty * 2 + 1; cy++)
+    {
+        if (cy < (rect->y0 >> child) || cy > (rect->y1 >> child)) continue;
+
+        for (int cx = tx * 2; cx <= tx * 2 + 1; cx++)
+        {
+            if (cx < (rect->x0 >> child) || cx > (rect->x1 >> child)) continue;
+            if (TileVisible(child, cx, cy, rect, nearest)) return true;
+        }
+    }
+    return false;
+}
+
+bool IsBoxOccluded(Vector3 min, Vector3 max)
+{
+    if (!occlusionStats.enabled || !occlusionReady) return false;
+
+    occlusionStats.tested++;
+
+    Vector3 corners[8];
+    BoxCorners(min, max, corners);
+
+    float minX = 1e30f, minY = 1e30f, maxX = -1e30f, maxY = -1e30f;
+    float nearest = DEPTH_EMPTY;
+
+    for (int i = 0; i < 8; i++)
+    {
+        ClipVertex v = ToClip(corners[i]);
+        if (v.z + v.w < 0.0f || v.w <= 1e-6f) return false;
+
+        float screen[3];
+        ToScreen(v, screen);
+        minX = fminf(minX, screen[0]);
+        maxX = fmaxf(maxX, screen[0]);
+        minY = fminf(minY, screen[1]);
+        maxY = fmaxf(maxY, screen[1]);
+        nearest = fminf(nearest, screen[2]);
+    }
+
+    // One texel of margin: occluder edges are sampled at texel centers, so a
+    // texel it only partly covers may read as covered
+    TexelRect rect = {
+        (int)floorf(minX) - 1, (int)floorf(minY) - 1,
+        (int)floorf(maxX) + 1, (int)floorf(maxY) + 1
+    };
+    if (rect.x1 < 0 || rect.y1 < 0 || rect.x0 >= OCCLUSION_WIDTH || rect.y0 >= OCCLUSION_HEIGHT) return false;
+    if (rect.x0 < 0) rect.x0 = 0;
+    if (rect.y0 < 0) rect.y0 = 0;
+    if (rect.x1 >= OCCLUSION_WIDTH) rect.x1 = OCCLUSION_WIDTH - 1;
+    if (rect.y1 >= OCCLUSION_HEIGHT) rect.y1 = OCCLUSION_HEIGHT - 1;
+
+    // Start at the finest level where the rect spans at most 2x2 tiles
+    int level = 0;
+    while (level < OCCLUSION_LEVELS - 1 &&
+           ((rect.x1 >> level) - (rect.x0 >> level) > 1 || (rect.y1 >> level) - (rect.y0 >> level) > 1))
+    {
+        level++;
+    }
+
+    for (int ty = rect.y0 >> level; ty <= (rect.y1 >> level); ty++)
+    {
+        for (int tx = rect.x0 >> level; tx <= (rect.x1 >> level); tx++)
+        {
+            if (TileVisible(level, tx, ty, &rect, nearest)) return false;
+        }
+    }
+
+    occlusionStats.occluded++;
+    return true;
+}
+
+bool IsOcclusionReady()
+{
+    return occlusionStats.enabled && occlusionReady;
+}
+
+const float* GetOcclusionDepth(int level, bool farthest, int* width, int* height)
+{
+    if (level < 0) level = 0;
+    if (level >= OCCLUSION_LEVELS) level = OCCLUSION_LEVELS - 1;
+
+    if (width) *width = LevelWidth(level);
+    if (height) *height = LevelHeight(level);
+    return LevelData(level, farthest);
+}
+
+void SetOcclusionEnabled(bool enabled)
+{
+    occlusionStats.enabled = enabled;
+    occlusionReady = false;
+    printf("Occlusion culling %s\n", enabled ? "enabled" : "disabled");
+}
+
+OcclusionStats* GetOcclusionStats()
+{
+    return &occlusionStats;
+}
@@ -0,0 +1,46 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Software Occlusion Culling Module
+//==================================================================
+
+#ifndef OCCLUSION_H
+#define OCCLUSION_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define OCCLUSION_WIDTH 256
+#define OCCLUSION_HEIGHT 128
+#define OCCLUSION_LEVELS 8          // 256x128 down to 2x1
+#define MAX_OCCLUDERS 64
+
+typedef struct
+{
+    bool enabled;
+    int occluders;
+    int trianglesRasterized;
+    int tested;
+    int occluded;
+} OcclusionStats;
+
+// Per frame, inside the 3D pass: clear the depth buffer for the given
+// view-projection, rasterize occluder boxes, then build the hierarchy.
+// Boxes are tested only after FinishOcclusionFrame.
+void BeginOcclusionFrame(Matrix viewProjection);
+void RasterizeOccluderBox(Vector3 min, Vector3 max);
+void FinishOcclusionFrame();
+
+// True only when every pixel the box could cover already holds something
+// nearer. Boxes crossing the near plane are never occluded.
+bool IsBoxOccluded(Vector3 min, Vector3 max);
+bool IsOcclusionReady();
+
+// Level 0 is OCCLUSION_WIDTH x OCCLUSION_HEIGHT, NDC depth, 1 = empty
+const float* GetOcclusionDepth(int level, bool farthest, int* width, int* height);
+
+void SetOcclusionEnabled(bool enabled);
+OcclusionStats* GetOcclusionStats();
+
+#endif
@@ -0,0 +1,392 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Retained HUD Overlay Implementation
+//==================================================================
+
+#include "overlay.h"
+#include "command_list.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    float x0, y0, x1, y1;
+    float u0, v0, u1, v1;
+} OverlayQuad;
+
+typedef struct
+{
+    bool used;
+    bool isRect;
+    char key[OVERLAY_KEY_LENGTH];
+    unsigned int seenFrame;
+
+    char text[OVERLAY_TEXT_LENGTH];
+    int x;
+    int y;
+    int width;                  // font size for text
+    int height;
+    Color color;
+
+    OverlayQuad quads[OVERLAY_TEXT_LENGTH];
+    int quadCount;
+} OverlayElement;
+
+static OverlayElement elements[MAX_OVERLAY_ELEMENTS];
+static int drawOrder[MAX_OVERLAY_ELEMENTS];
+static int drawOrderCount = 0;
+static int lastOrder[MAX_OVERLAY_ELEMENTS];
+static int lastOrderCount = -1;
+static unsigned int overlayFrame = 0;
+static bool overlayDirty = true;
+static OverlayStats overlayStats = {0};
+
+static Mesh overlayMesh;
+static Material overlayMaterial;
+static bool overlayReady = false;
+
+static bool LoadOverlayBuffers()
+{
+    Mesh mesh = {0};
+    mesh.vertexCount = MAX_OVERLAY_QUADS * 4;
+    mesh.triangleCount = MAX_OVERLAY_QUADS * 2;
+    mesh.vertices = (float*)calloc(mesh.vertexCount * 3, sizeof(float));
+    mesh.texcoords = (float*)calloc(mesh.vertexCount * 2, sizeof(float));
+    mesh.colors = (unsigned char*)calloc(mesh.vertexCount * 4, sizeof(unsigned char));
+    mesh.indices = (unsigned short*)calloc(mesh.triangleCount * 3, sizeof(unsigned short));
+
+    if (!mesh.vertices || !mesh.texcoords || !mesh.colors || !mesh.indices)
+    {
+        printf("Warning: Out of memory creating HUD overlay\n");
+        free(mesh.vertices);
+        free(mesh.texcoords);
+        free(mesh.colors);
+        free(mesh.indices);
+        return false;
+    }
+
+    for (int q = 0; q < MAX_OVERLAY_QUADS; q++)
+    {
+        unsigned short* index = &mesh.indices[q * 6];
+        unsigned short base = (unsigned short)(q * 4);
+        index[0] = base;
+        index[1] = (unsigned short)(base + 1);
+        index[2] = (unsigned short)(base + 2);
+        index[3] = base;
+        index[4] = (unsigned short)(base + 2);
+        index[5] = (unsigned short)(base + 3);
+    }
+
+    UploadMesh(&mesh, true);
+    overlayMesh = mesh;
+
+    overlayMaterial = LoadMaterialDefault();
+    overlayMaterial.maps[MATERIAL_MAP_DIFFUSE].texture = GetFontDefault().texture;
+    overlayMaterial.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+
+    overlayReady = true;
+    return true;
+}
+
+static int FindOverlayElement(const char* key)
+{
+    int freeSlot = -1;
+
+    for (int i = 0; i < MAX_OVERLAY_ELEMENTS; i++)
+    {
+        if (!elements[i].used)
+        {
+            if (freeSlot < 0) freeSlot = i;
+            continue;
+        }
+
+        if (strncmp(elements[i].key, key, OVERLAY_KEY_LENGTH - 1) == 0) return i;
+    }
+
+    if (freeSlot < 0)
+    {
+        printf("Warning: Too many HUD overlay elements, '%s' skipped\n", key);
+        return -1;
+    }
+
+    OverlayElement* element = &elements[freeSlot];
+    memset(element, 0, sizeof(OverlayElement));
+    element->used = true;
+    element->width = -1;
+    strncpy(element->key, key, OVERLAY_KEY_LENGTH - 1);
+    return freeSlot;
+}
+
+// Same placement as DrawText/DrawTextEx with the default font
+static void LayoutText(OverlayElement* element)
+{
+    Font font = GetFontDefault();
+    int fontSize = element->width < 10 ? 10 : element->width;
+    float spacing = (float)(fontSize / 10);
+    float scale = (float)fontSize / font.baseSize;
+    float padding = (float)font.glyphPadding;
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+    int length = (int)strlen(element->text);
+
+    element->quadCount = 0;
+
+    for (int i = 0; i < length;)
+    {
+        int codepointSize = 0;
+        int codepoint = GetCodepointNext(&element->text[i], &codepointSize);
+        int index = GetGlyphIndex(font, codepoint);
+        i += codepointSize;
+
+        if (codepoint == '\n')
+        {
+            offsetY += (font.baseSize + font.baseSize / 2.0f) * scale;
+            offsetX = 0.0f;
+            continue;
+        }
+
+        Rectangle rec = font.recs[index];
+        if (codepoint != ' ' && codepoint != '\t')
+        {
+            OverlayQuad* quad = &element->quads[element->quadCount++];
+            quad->x0 = element->x + offsetX + (font.glyphs[index].offsetX - padding) * scale;
+            quad->y0 = element->y + offsetY + (font.glyphs[index].offsetY - padding) * scale;
+            quad->x1 = quad->x0 + (rec.width + 2.0f * padding) * scale;
+            quad->y1 = quad->y0 + (rec.height + 2.0f * padding) * scale;
+            quad->u0 = (rec.x - padding) / font.texture.width;
+            quad->v0 = (rec.y - padding) / font.texture.height;
+            quad->u1 = (rec.x + rec.width + padding) / font.texture.width;
+            quad->v1 = (rec.y + rec.height + padding) / font.texture.height;
+        }
+
+        float advance = font.glyphs[index].advanceX ? (float)font.glyphs[index].advanceX : rec.width;
+        offsetX += advance * scale + spacing;
+    }
+
+    overlayStats.layouts++;
+}
+
+static void LayoutRect(OverlayElement* element)
+{
+    // The default font reserves a white texel, as raylib's shape drawing does
+    Font font = GetFontDefault();
+    float texelU = (font.recs[95].x + 2.5f) / font.texture.width;
+    float texelV = (font.recs[95].y + 2.5f) / font.texture.height;
+    OverlayQuad* quad = &element->quads[0];
+
+    quad->x0 = (float)element->x;
+    quad->y0 = (float)element->y;
+    quad->x1 = (float)(element->x + element->width);
+    quad->y1 = (float)(element->y + element->height);
+    quad->u0 = quad->u1 = texelU;
+    quad->v0 = quad->v1 = texelV;
+    element->quadCount = 1;
+
+    overlayStats.layouts++;
+}
+
+static void SubmitElement(int slot)
+{
+    if (drawOrderCount >= MAX_OVERLAY_ELEMENTS) return;
+
+    elements[slot].seenFrame = overlayFrame;
+    if (lastOrderCount <= drawOrderCount || lastOrder[drawOrderCount] != slot) overlayDirty = true;
+    drawOrder[drawOrderCount++] = slot;
+}
+
+static bool SameColor(Color a, Color b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+void BeginOverlay()
+{
+    overlayFrame++;
+    drawOrderCount = 0;
+    overlayStats.layouts = 0;
+    overlayStats.uploads = 0;
+    overlayStats.drawCalls = 0;
+}
+
+void OverlayText(const char* key, const char* text, int x, int y, int fontSize, Color color)
+{
+    int slot = FindOverlayElement(key);
+    if (slot < 0) return;
+
+    OverlayElement* element = &elements[slot];
+    if (element->isRect || element->x != x || element->y != y || element->width != fontSize ||
+        strncmp(element->text, text, OVERLAY_TEXT_LENGTH - 1) != 0)
+    {
+        element->isRect = false;
+        element->x = x;
+        element->y = y;
+        element->width = fontSize;
+        strncpy(element->text, text, OVERLAY_TEXT_LENGTH - 1);
+        element->text[OVERLAY_TEXT_LENGTH - 1] = '\0';
+        LayoutText(element);
+        overlayDirty = true;
+    }
+
+    if (!SameColor(element->color, color))
+    {
+        element->color = color;
+        overlayDirty = true;
+    }
+
+    SubmitElement(slot);
+}
+
+void OverlayRect(const char* key, int x, int y, int width, int height, Color color)
+{
+    int slot = FindOverlayElement(key);
+    if (slot < 0) return;
+
+    OverlayElement* element = &elements[slot];
+    if (!element->isRect || element->x != x || element->y != y ||
+        element->width != width || element->height != height)
+    {
+        element->isRect = true;
+        element->x = x;
+        element->y = y;
+        element->width = width;
+        element->height = height;
+        element->text[0] = '\0';
+        LayoutRect(element);
+        overlayDirty = true;
+    }
+
+    if (!SameColor(element->color, color))
+    {
+        element->color = color;
+        overlayDirty = true;
+    }
+
+    SubmitElement(slot);
+}
+
+void OverlayFPS(const char* key, int x, int y)
+{
+    int fps = GetFPS();
+    Color color = LIME;
+
+    if (fps < 15) color = RED;
+    else if (fps < 30) color = ORANGE;
+
+    OverlayText(key, TextFormat("%2i FPS", fps), x, y, 20, color);
+}
+
+static void RebuildOverlayBuffers()
+{
+    int quads = 0;
+
+    for (int o = 0; o < drawOrderCount; o++)
+    {
+        OverlayElement* element = &elements[drawOrder[o]];
+
+        for (int q = 0; q < element->quadCount; q++)
+        {
+            if (quads >= MAX_OVERLAY_QUADS) break;
+
+            OverlayQuad* quad = &element->quads[q];
+            float corners[4][4] = {
+                {quad->x0, quad->y0, quad->u0, quad->v0},
+                {quad->x0, quad->y1, quad->u0, quad->v1},
+                {quad->x1, quad->y1, quad->u1, quad->v1},
+                {quad->x1, quad->y0, quad->u1, quad->v0}
+            };
+
+            for (int c = 0; c < 4; c++)
+            {
+                int v = quads * 4 + c;
+                overlayMesh.vertices[v*3 + 0] = corners[c][0];
+                overlayMesh.vertices[v*3 + 1] = corners[c][1];
+                overlayMesh.vertices[v*3 + 2] = 0.0f;
+                overlayMesh.texcoords[v*2 + 0] = corners[c][2];
+                overlayMesh.texcoords[v*2 + 1] = corners[c][3];
+                overlayMesh.colors[v*4 + 0] = element->color.r;
+                overlayMesh.colors[v*4 + 1] = element->color.g;
+                overlayMesh.colors[v*4 + 2] = element->color.b;
+                overlayMesh.colors[v*4 + 3] = element->color.a;
+            }
+            quads++;
+        }
+    }
+
+    if (quads > 0)
+    {
+        int vertices = quads * 4;
+        UpdateMeshBuffer(overlayMesh, 0, overlayMesh.vertices, vertices * 3 * sizeof(float), 0);
+        UpdateMeshBuffer(overlayMesh, 1, overlayMesh.texcoords, vertices * 2 * sizeof(float), 0);
+        UpdateMeshBuffer(overlayMesh, 3, overlayMesh.colors, vertices * 4 * sizeof(unsigned char), 0);
+        overlayStats.uploads++;
+    }
+
+    overlayStats.quads = quads;
+}
+
+void DrawOverlay()
+{
+    // Anything dropped this frame changes what the buffer must hold
+    overlayStats.elements = 0;
+    for (int i = 0; i < MAX_OVERLAY_ELEMENTS; i++)
+    {
+        if (!elements[i].used) continue;
+
+        if (elements[i].seenFrame != overlayFrame)
+        {
+            elements[i].used = false;
+            overlayDirty = true;
+            continue;
+        }
+        overlayStats.elements++;
+    }
+
+    if (drawOrderCount != lastOrderCount) overlayDirty = true;
+    memcpy(lastOrder, drawOrder, drawOrderCount * sizeof(int));
+    lastOrderCount = drawOrderCount;
+
+    if (!overlayReady && !LoadOverlayBuffers()) return;
+
+    if (overlayDirty)
+    {
+        RebuildOverlayBuffers();
+        overlayDirty = false;
+    }
+
+    if (overlayStats.quads == 0) return;
+
+    // Culling off also flushes whatever 2D shapes were queued before the HUD
+    Matrix identity = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+    overlayMesh.triangleCount = overlayStats.quads * 2;
+    PushMeshCommand(RENDER_PASS_OVERLAY, &overlayMesh, &overlayMaterial, 0, WHITE, identity,
+                    RENDER_STATE_NO_CULLING);
+    SubmitRenderCommands();
+    overlayStats.drawCalls++;
+}
+
+void CloseOverlay()
+{
+    if (overlayReady)
+    {
+        // The font atlas belongs to raylib
+        overlayMesh.triangleCount = MAX_OVERLAY_QUADS * 2;
+        UnloadMesh(overlayMesh);
+        overlayMaterial.maps[MATERIAL_MAP_DIFFUSE].texture.id = rlGetTextureIdDefault();
+        UnloadMaterial(overlayMaterial);
+        overlayReady = false;
+    }
+
+    memset(elements, 0, sizeof(elements));
+    drawOrderCount = 0;
+    lastOrderCount = -1;
+    overlayDirty = true;
+}
+
+OverlayStats* GetOverlayStats()
+{
+    return &overlayStats;
+}
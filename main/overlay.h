@@ -0,0 +1,43 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Retained HUD Overlay Module
+//==================================================================
+
+#ifndef OVERLAY_H
+#define OVERLAY_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define MAX_OVERLAY_ELEMENTS 96
+#define MAX_OVERLAY_QUADS 4096          // 4 vertices each, 16-bit indices
+#define OVERLAY_TEXT_LENGTH 128
+#define OVERLAY_KEY_LENGTH 32
+
+typedef struct
+{
+    int elements;
+    int quads;
+    int layouts;
+    int uploads;
+    int drawCalls;
+} OverlayStats;
+
+// Elements are submitted every frame between BeginOverlay and DrawOverlay
+// and identified by key. Glyph quads are laid out again only when an
+// element's text, position or size changes, and the combined vertex buffer
+// is re-uploaded only when something changed. Everything is drawn with the
+// default font atlas in a single draw call. Elements not submitted in a
+// frame are dropped.
+void BeginOverlay();
+void OverlayText(const char* key, const char* text, int x, int y, int fontSize, Color color);
+void OverlayRect(const char* key, int x, int y, int width, int height, Color color);
+void OverlayFPS(const char* key, int x, int y);
+void DrawOverlay();
+void CloseOverlay();
+
+OverlayStats* GetOverlayStats();
+
+#endif
@@ -12,8 +12,11 @@
 #include <string.h>
 #include <math.h>
 
+#define PARTICLE_BATCH_SIZE 256
+
 static ParticleEmitter* emitters[MAX_EMITTERS];
 static int emitterCount = 0;
+static InstanceData particleBatch[PARTICLE_BATCH_SIZE];
 
 void InitParticleSystem()
 {
@@ -97,21 +100,34 @@ void UpdateParticles(float deltaTime)
     }
 }
 
-void RenderParticles()
+// Camera-facing quad, screen aligned like DrawBillboard
+static InstanceData MakeParticleInstance(Vector3 position, float size, Color color,
+                                         Vector3 right, Vector3 up, Vector3 facing)
 {
-    Camera3D* cam = GetCamera();
-    
+    return (InstanceData){
+        { right.x * size, right.y * size, right.z * size, 0,
+          up.x * size, up.y * size, up.z * size, 0,
+          facing.x, facing.y, facing.z, 0,
+          position.x, position.y, position.z, 1 },
+        color,
+        { 0.0f, 0.0f, 1.0f, 1.0f }
+    };
+}
+
+int GatherParticleSprites(ParticleSprite* sprites, int capacity)
+{
+    int count = 0;
+
     for (int i = 0; i < emitterCount; i++)
     {
         ParticleEmitter* emitter = emitters[i];
         if (!emitter) continue;
-        
-        for (int j = 0; j < emitter->maxParticles; j++)
+
+        for (int j = 0; j < emitter->maxParticles && count < capacity; j++)
         {
             Particle* p = &emitter->particles[j];
             if (!p->active) continue;
 
-            
             Vector3 pos = p->position;
             if (!emitter->worldSpace)
             {
@@ -120,11 +136,39 @@ void RenderParticles()
                 pos.z += emitter->position.z;
             }
 
-            DrawBillboard(*cam, 
-                         (Texture2D){.id = 0, .width = 1, .height = 1, .mipmaps = 1, .format = 0},
-                         pos, p->size, p->color);
+            sprites[count++] = (ParticleSprite){ pos, p->size, p->color };
+        }
+    }
+
+    return count;
+}
+
+// Particles go out as instanced quads, recorded in fixed-size runs
+void RecordParticles(RenderCommandList* list, const ParticleSprite* sprites, int count, Camera3D camera)
+{
+    const Mesh* quad = GetCachedQuadMesh();
+    int batched = 0;
+
+    Vector3 forward = Vector3Normalize(Vector3Subtract(camera.target, camera.position));
+    Vector3 right = Vector3CrossProduct(forward, camera.up);
+    right = (Vector3Length(right) < 0.001f) ? (Vector3){ 1.0f, 0.0f, 0.0f } : Vector3Normalize(right);
+    Vector3 up = Vector3CrossProduct(right, forward);
+    Vector3 facing = Vector3Scale(forward, -1.0f);
+
+    for (int i = 0; i < count; i++)
+    {
+        const ParticleSprite* sprite = &sprites[i];
+        if (!IsSphereInView(sprite->position, sprite->size * 0.5f, CULL_PARTICLES)) continue;
+
+        particleBatch[batched++] = MakeParticleInstance(sprite->position, sprite->size, sprite->color, right, up, facing);
+        if (batched == PARTICLE_BATCH_SIZE)
+        {
+            RecordInstancesCommand(list, RENDER_PASS_EFFECTS, quad, 0, particleBatch, batched, 0);
+            batched = 0;
         }
     }
+
+    RecordInstancesCommand(list, RENDER_PASS_EFFECTS, quad, 0, particleBatch, batched, 0);
 }
 
 ParticleEmitter* CreateParticleEmitter(const char* name, Vector3 position, ParticleType type)
@@ -9,6 +9,7 @@
 #define PARTICLES_H
 
 #include "raylib.h"
+#include "command_list.h"
 #include <stdbool.h>
 
 typedef enum
@@ -69,11 +70,25 @@ typedef struct ParticleEmitter
 
 #define MAX_EMITTERS 20
 #define MAX_PARTICLES_PER_EMITTER 500
+#define MAX_PARTICLE_SPRITES (MAX_EMITTERS * MAX_PARTICLES_PER_EMITTER)
+
+// A live particle as a frame draws it, in world space
+typedef struct
+{
+    Vector3 position;
+    float size;
+    Color color;
+} ParticleSprite;
 
 void InitParticleSystem();
 void CloseParticleSystem();
 void UpdateParticles(float deltaTime);
-void RenderParticles();
+
+// Main thread: copies the live particles for a frame recorded later
+int GatherParticleSprites(ParticleSprite* sprites, int capacity);
+
+// Culls the sprites and records them as camera-facing instanced quads
+void RecordParticles(RenderCommandList* list, const ParticleSprite* sprites, int count, Camera3D camera);
 
 ParticleEmitter* CreateParticleEmitter(const char* name, Vector3 position, ParticleType type);
 void DestroyParticleEmitter(ParticleEmitter* emitter);
@@ -33,13 +33,20 @@
 // ==================================================================
 #include "physics.h"
 #include "engine.h"
+#include "physics_thread.h"
 #include <math.h>
 #include <stdio.h>
 
-static bool CheckPlayerCollision(GameObject* player, GameObject* other);
+typedef bool (*NarrowphaseFunc)(GameObject* a, GameObject* b, ContactInfo* contact);
+
+static PhysicsStats physicsStats = {0};
+static PhysicsContact contacts[MAX_CONTACTS];
+static int contactCount = 0;
 
 void InitPhysics()
 {
+    physicsStats = (PhysicsStats){0};
+    contactCount = 0;
 }
 
 void SetGravity(float gravity)
@@ -77,12 +84,10 @@ void SetPlayerPhysicsSettings(float walkSpeed, float runSpeed, float jumpForce,
     printf("  Gravity: %.1f\n", gravity);
 }
 
-void ApplyPhysicsToObject(GameObject* obj, float dt)
+static void IntegrateBody(GameObject* obj, const PlayerPhysicsSettings* settings, float dt)
 {
     if (!obj->hasPhysics || obj->isStatic) return;
     
-    PlayerPhysicsSettings* settings = GetPlayerSettings();
-    
     if (obj->type != OBJ_PLAYER)
     {
         obj->physics.velocity.y += settings->gravity * dt;
@@ -123,66 +128,105 @@ void ApplyPhysicsToObject(GameObject* obj, float dt)
     }
 }
 
+void ApplyPhysicsToObject(GameObject* obj, float dt)
+{
+    IntegrateBody(obj, GetPlayerSettings(), dt);
+}
+
 void UpdatePhysics(float deltaTime)
 {
-    GameObject** objects = GetObjects();
-    int* objectCount = GetObjectCount();
+    // The physics thread owns the simulation while it is running
+    if (IsPhysicsThreadRunning()) return;
     
-    for (int i = 0; i < *objectCount; i++)
+    SimulatePhysics(GetObjects(), *GetObjectCount(), GetPlayerSettings(), deltaTime);
+}
+
+void SimulatePhysics(GameObject** objects, int objectCount,
+                     const PlayerPhysicsSettings* settings, float deltaTime)
+{
+    for (int i = 0; i < objectCount; i++)
     {
         if (objects[i] && objects[i]->hasPhysics && objects[i]->isActive && 
             objects[i]->type != OBJ_PLAYER)
         {
-            ApplyPhysicsToObject(objects[i], deltaTime);
+            IntegrateBody(objects[i], settings, deltaTime);
         }
     }
     
-    for (int i = 0; i < *objectCount; i++)
+    physicsStats = (PhysicsStats){0};
+    contactCount = 0;
+    
+    for (int i = 0; i < objectCount; i++)
     {
         if (!objects[i] || !objects[i]->hasCollision || !objects[i]->isActive) continue;
         
-        for (int j = i + 1; j < *objectCount; j++)
+        for (int j = i + 1; j < objectCount; j++)
         {
             if (!objects[j] || !objects[j]->hasCollision || !objects[j]->isActive) continue;
             
-            if (CheckAABBCollision(objects[i], objects[j]) || 
-                (objects[i]->type == OBJ_PLAYER && CheckPlayerCollision(objects[i], objects[j])) ||
-                (objects[j]->type == OBJ_PLAYER && CheckPlayerCollision(objects[j], objects[i])))
+            physicsStats.pairsTested++;
+            
+            if (!CheckAABBCollision(objects[i], objects[j]))
             {
-                ResolveCollision(objects[i], objects[j]);
+                physicsStats.broadphaseRejects++;
+                continue;
             }
+            
+            ContactInfo contact;
+            physicsStats.narrowphaseTests++;
+            
+            if (!ComputeContact(objects[i], objects[j], &contact))
+            {
+                physicsStats.narrowphaseRejects++;
+                continue;
+            }
+            
+            physicsStats.contacts++;
+            if (contactCount < MAX_CONTACTS)
+            {
+                contacts[contactCount].bodyA = i;
+                contacts[contactCount].bodyB = j;
+                contacts[contactCount].info = contact;
+                contactCount++;
+            }
+            
+            ResolveContact(objects[i], objects[j], &contact);
         }
     }
 }
 
 void UpdatePlayerPhysics(float deltaTime)
 {
-    GameObject** playerObj = GetPlayerObject();
-    PlayerPhysicsSettings* settings = GetPlayerSettings();
+    if (IsPhysicsThreadRunning()) return;
     
-    if (!*playerObj) return;
+    SimulatePlayerPhysics(*GetPlayerObject(), GetPlayerSettings(), deltaTime);
+}
+
+void SimulatePlayerPhysics(GameObject* player, const PlayerPhysicsSettings* settings, float deltaTime)
+{
+    if (!player) return;
     
-    if (!(*playerObj)->physics.isGrounded)
+    if (!player->physics.isGrounded)
     {
-        (*playerObj)->physics.velocity.y += settings->gravity * deltaTime;
+        player->physics.velocity.y += settings->gravity * deltaTime;
     }
     
-    (*playerObj)->position.x += (*playerObj)->physics.velocity.x * deltaTime;
-    (*playerObj)->position.y += (*playerObj)->physics.velocity.y * deltaTime;
-    (*playerObj)->position.z += (*playerObj)->physics.velocity.z * deltaTime;
+    player->position.x += player->physics.velocity.x * deltaTime;
+    player->position.y += player->physics.velocity.y * deltaTime;
+    player->position.z += player->physics.velocity.z * deltaTime;
     
     float groundLevel = settings->playerHeight / 2;
-    if ((*playerObj)->position.y <= groundLevel)
+    if (player->position.y <= groundLevel)
     {
-        (*playerObj)->position.y = groundLevel;
-        (*playerObj)->physics.velocity.y = 0;
-        (*playerObj)->physics.isGrounded = true;
+        player->position.y = groundLevel;
+        player->physics.velocity.y = 0;
+        player->physics.isGrounded = true;
     }
     
-    if ((*playerObj)->physics.isGrounded)
+    if (player->physics.isGrounded)
     {
-        (*playerObj)->physics.velocity.x *= settings->groundFriction;
-        (*playerObj)->physics.velocity.z *= settings->groundFriction;
+        player->physics.velocity.x *= settings->groundFriction;
+        player->physics.velocity.z *= settings->groundFriction;
     }
 }
 
@@ -190,6 +234,8 @@ void ApplyForce(GameObject* obj, Vector3 force)
 {
     if (obj && obj->hasPhysics)
     {
+        if (QueuePhysicsForce(obj, force)) return;
+        
         obj->physics.velocity.x += force.x / obj->physics.mass;
         obj->physics.velocity.y += force.y / obj->physics.mass;
         obj->physics.velocity.z += force.z / obj->physics.mass;
@@ -246,152 +292,389 @@ bool CheckSphereCollision(Vector3 c1, float r1, Vector3 c2, float r2)
     return distanceSquared <= radiusSum * radiusSum;
 }
 
-static bool CheckPlayerCollision(GameObject* player, GameObject* other)
+CollisionShape GetCollisionShape(GameObject* obj)
 {
-    if (!player || !other || !other->hasCollision) return false;
-    
-    Vector3 playerCenter = player->position;
-    playerCenter.y += player->size.y/2 - player->size.x/2;
-    
-    float playerRadius = player->size.x / 2;
-    
-    if (other->type == OBJ_SPHERE)
+    switch (obj->type)
     {
-        return CheckSphereCollision(playerCenter, playerRadius, 
-                                   other->position, other->size.x/2);
+        case OBJ_SPHERE: return SHAPE_SPHERE;
+        case OBJ_PLAYER: return SHAPE_CAPSULE;
+        default: return SHAPE_BOX;
     }
-    else
+}
+
+// Capsules are always upright: a vertical segment of +-halfSegment around
+// the object position, swept by the radius.
+static void GetCapsule(GameObject* obj, float* radius, float* halfSegment)
+{
+    *radius = obj->size.x / 2;
+    *halfSegment = obj->size.y / 2 - *radius;
+    if (*halfSegment < 0) *halfSegment = 0;
+}
+
+static float ClosestOnRange(float min, float max, float otherMin, float otherMax)
+{
+    float lo = fmaxf(min, otherMin);
+    float hi = fminf(max, otherMax);
+
+    if (lo <= hi) return (lo + hi) * 0.5f;
+    return (otherMax < min) ? min : max;
+}
+
+static bool FlipContact(bool hit, ContactInfo* contact)
+{
+    if (hit)
     {
-        return CheckSphereAABBCollision(playerCenter, playerRadius, other);
+        contact->normal.x = -contact->normal.x;
+        contact->normal.y = -contact->normal.y;
+        contact->normal.z = -contact->normal.z;
     }
+    return hit;
 }
 
-bool CheckCollision(GameObject* a, GameObject* b)
+static bool SphereVsSphere(Vector3 ca, float ra, Vector3 cb, float rb, ContactInfo* contact)
 {
-    if (!a || !b || !a->hasCollision || !b->hasCollision) return false;
-    
-    if (a->type == OBJ_SPHERE || b->type == OBJ_SPHERE)
+    float dx = cb.x - ca.x;
+    float dy = cb.y - ca.y;
+    float dz = cb.z - ca.z;
+    float distanceSquared = dx*dx + dy*dy + dz*dz;
+    float radiusSum = ra + rb;
+
+    if (distanceSquared >= radiusSum * radiusSum) return false;
+
+    float distance = sqrtf(distanceSquared);
+    if (distance > 0.0001f)
     {
-        float radiusA = (a->type == OBJ_SPHERE) ? a->size.x/2 : fmaxf(a->size.x, fmaxf(a->size.y, a->size.z))/2;
-        float radiusB = (b->type == OBJ_SPHERE) ? b->size.x/2 : fmaxf(b->size.x, fmaxf(b->size.y, b->size.z))/2;
-        
-        float dx = b->position.x - a->position.x;
-        float dy = b->position.y - a->position.y;
-        float dz = b->position.z - a->position.z;
-        float distanceSquared = dx*dx + dy*dy + dz*dz;
-        float radiusSum = radiusA + radiusB;
-        
-        return distanceSquared <= radiusSum * radiusSum;
+        contact->normal = (Vector3){dx/distance, dy/distance, dz/distance};
     }
     else
     {
-        return CheckAABBCollision(a, b);
+        contact->normal = (Vector3){0, 1, 0};
     }
+
+    contact->depth = radiusSum - distance;
+    contact->point.x = ca.x + contact->normal.x * ra;
+    contact->point.y = ca.y + contact->normal.y * ra;
+    contact->point.z = ca.z + contact->normal.z * ra;
+    return true;
 }
 
-void ResolvePlayerCollision(GameObject* player, GameObject* other)
+static bool SphereVsBox(Vector3 center, float radius, GameObject* box, ContactInfo* contact)
 {
-    if (!player || !other) return;
-    
-    Vector3 playerCenter = player->position;
-    playerCenter.y += player->size.y/2 - player->size.x/2;
-    float playerRadius = player->size.x / 2;
-    
-    Vector3 closestPoint;
-    
-    if (other->type == OBJ_SPHERE)
+    Vector3 half = {box->size.x / 2, box->size.y / 2, box->size.z / 2};
+    Vector3 local = {center.x - box->position.x, center.y - box->position.y, center.z - box->position.z};
+
+    Vector3 closest;
+    closest.x = fmaxf(-half.x, fminf(local.x, half.x));
+    closest.y = fmaxf(-half.y, fminf(local.y, half.y));
+    closest.z = fmaxf(-half.z, fminf(local.z, half.z));
+
+    float dx = local.x - closest.x;
+    float dy = local.y - closest.y;
+    float dz = local.z - closest.z;
+    float distanceSquared = dx*dx + dy*dy + dz*dz;
+
+    if (distanceSquared >= radius * radius) return false;
+
+    Vector3 outward;
+    if (distanceSquared > 0.000001f)
     {
-        Vector3 delta = (Vector3){other->position.x - playerCenter.x,
-                                 other->position.y - playerCenter.y,
-                                 other->position.z - playerCenter.z};
-        float distance = sqrtf(delta.x*delta.x + delta.y*delta.y + delta.z*delta.z);
-        if (distance == 0) return;
-        
-        Vector3 normal = (Vector3){delta.x/distance, delta.y/distance, delta.z/distance};
-        closestPoint.x = other->position.x - normal.x * other->size.x/2;
-        closestPoint.y = other->position.y - normal.y * other->size.y/2;
-        closestPoint.z = other->position.z - normal.z * other->size.z/2;
+        float distance = sqrtf(distanceSquared);
+        outward = (Vector3){dx/distance, dy/distance, dz/distance};
+        contact->depth = radius - distance;
     }
     else
     {
-        closestPoint.x = fmaxf(other->position.x - other->size.x/2, 
-                             fminf(playerCenter.x, other->position.x + other->size.x/2));
-        closestPoint.y = fmaxf(other->position.y - other->size.y/2, 
-                             fminf(playerCenter.y, other->position.y + other->size.y/2));
-        closestPoint.z = fmaxf(other->position.z - other->size.z/2, 
-                             fminf(playerCenter.z, other->position.z + other->size.z/2));
-    }
-    
-    float dx = playerCenter.x - closestPoint.x;
-    float dy = playerCenter.y - closestPoint.y;
-    float dz = playerCenter.z - closestPoint.z;
-    float collisionDistance = sqrtf(dx*dx + dy*dy + dz*dz);
-    
-    if (collisionDistance < playerRadius && collisionDistance > 0)
-    {
-        Vector3 normal = (Vector3){dx/collisionDistance, dy/collisionDistance, dz/collisionDistance};
-        
-        float overlap = playerRadius - collisionDistance;
-        player->position.x += normal.x * overlap * 0.5f;
-        player->position.y += normal.y * overlap * 0.5f;
-        player->position.z += normal.z * overlap * 0.5f;
-        
-        if (normal.y > 0.7f)
+        // Center is inside the box: push out through the nearest face
+        float px = half.x - fabsf(local.x);
+        float py = half.y - fabsf(local.y);
+        float pz = half.z - fabsf(local.z);
+
+        if (px <= py && px <= pz)
         {
-            player->physics.isGrounded = true;
-            player->physics.velocity.y = 0;
+            outward = (Vector3){local.x < 0 ? -1.0f : 1.0f, 0, 0};
+            contact->depth = radius + px;
         }
-        
-        float velocityDot = player->physics.velocity.x * normal.x + 
-                           player->physics.velocity.z * normal.z;
-        if (velocityDot < 0)
+        else if (py <= pz)
+        {
+            outward = (Vector3){0, local.y < 0 ? -1.0f : 1.0f, 0};
+            contact->depth = radius + py;
+        }
+        else
         {
-            player->physics.velocity.x -= normal.x * velocityDot * 0.8f;
-            player->physics.velocity.z -= normal.z * velocityDot * 0.8f;
+            outward = (Vector3){0, 0, local.z < 0 ? -1.0f : 1.0f};
+            contact->depth = radius + pz;
         }
     }
+
+    // Normal points from the sphere towards the box
+    contact->normal = (Vector3){-outward.x, -outward.y, -outward.z};
+    contact->point.x = box->position.x + closest.x;
+    contact->point.y = box->position.y + closest.y;
+    contact->point.z = box->position.z + closest.z;
+    return true;
+}
+
+static bool CollideSphereSphere(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    return SphereVsSphere(a->position, a->size.x / 2, b->position, b->size.x / 2, contact);
+}
+
+static bool CollideSphereBox(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    return SphereVsBox(a->position, a->size.x / 2, b, contact);
+}
+
+static bool CollideBoxSphere(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    return FlipContact(CollideSphereBox(b, a, contact), contact);
+}
+
+// Separating axis test for two axis-aligned boxes: the axis of least
+// overlap gives the contact normal and depth.
+static bool CollideBoxBox(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    float dx = b->position.x - a->position.x;
+    float dy = b->position.y - a->position.y;
+    float dz = b->position.z - a->position.z;
+
+    float ox = (a->size.x + b->size.x) / 2 - fabsf(dx);
+    if (ox <= 0) return false;
+    float oy = (a->size.y + b->size.y) / 2 - fabsf(dy);
+    if (oy <= 0) return false;
+    float oz = (a->size.z + b->size.z) / 2 - fabsf(dz);
+    if (oz <= 0) return false;
+
+    if (ox <= oy && ox <= oz)
+    {
+        contact->normal = (Vector3){dx < 0 ? -1.0f : 1.0f, 0, 0};
+        contact->depth = ox;
+    }
+    else if (oy <= oz)
+    {
+        contact->normal = (Vector3){0, dy < 0 ? -1.0f : 1.0f, 0};
+        contact->depth = oy;
+    }
+    else
+    {
+        contact->normal = (Vector3){0, 0, dz < 0 ? -1.0f : 1.0f};
+        contact->depth = oz;
+    }
+
+    contact->point.x = (fmaxf(a->position.x - a->size.x/2, b->position.x - b->size.x/2) +
+                        fminf(a->position.x + a->size.x/2, b->position.x + b->size.x/2)) * 0.5f;
+    contact->point.y = (fmaxf(a->position.y - a->size.y/2, b->position.y - b->size.y/2) +
+                        fminf(a->position.y + a->size.y/2, b->position.y + b->size.y/2)) * 0.5f;
+    contact->point.z = (fmaxf(a->position.z - a->size.z/2, b->position.z - b->size.z/2) +
+                        fminf(a->position.z + a->size.z/2, b->position.z + b->size.z/2)) * 0.5f;
+    return true;
+}
+
+static bool CollideCapsuleSphere(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    float radius, halfSegment;
+    GetCapsule(a, &radius, &halfSegment);
+
+    Vector3 center = a->position;
+    center.y = fmaxf(a->position.y - halfSegment, fminf(b->position.y, a->position.y + halfSegment));
+
+    return SphereVsSphere(center, radius, b->position, b->size.x / 2, contact);
+}
+
+static bool CollideSphereCapsule(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    return FlipContact(CollideCapsuleSphere(b, a, contact), contact);
+}
+
+static bool CollideCapsuleBox(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    float radius, halfSegment;
+    GetCapsule(a, &radius, &halfSegment);
+
+    Vector3 center = a->position;
+    center.y = ClosestOnRange(a->position.y - halfSegment, a->position.y + halfSegment,
+                              b->position.y - b->size.y/2, b->position.y + b->size.y/2);
+
+    return SphereVsBox(center, radius, b, contact);
+}
+
+static bool CollideBoxCapsule(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    return FlipContact(CollideCapsuleBox(b, a, contact), contact);
+}
+
+static bool CollideCapsuleCapsule(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    float ra, ha, rb, hb;
+    GetCapsule(a, &ra, &ha);
+    GetCapsule(b, &rb, &hb);
+
+    Vector3 ca = a->position;
+    Vector3 cb = b->position;
+    ca.y = ClosestOnRange(a->position.y - ha, a->position.y + ha, b->position.y - hb, b->position.y + hb);
+    cb.y = fmaxf(b->position.y - hb, fminf(ca.y, b->position.y + hb));
+
+    return SphereVsSphere(ca, ra, cb, rb, contact);
+}
+
+static const NarrowphaseFunc narrowphaseTable[SHAPE_COUNT][SHAPE_COUNT] = {
+    /* SHAPE_SPHERE  */ { CollideSphereSphere,  CollideSphereBox,  CollideSphereCapsule  },
+    /* SHAPE_BOX     */ { CollideBoxSphere,     CollideBoxBox,     CollideBoxCapsule     },
+    /* SHAPE_CAPSULE */ { CollideCapsuleSphere, CollideCapsuleBox, CollideCapsuleCapsule }
+};
+
+bool ComputeContact(GameObject* a, GameObject* b, ContactInfo* contact)
+{
+    if (!a || !b || a == b) return false;
+
+    NarrowphaseFunc collide = narrowphaseTable[GetCollisionShape(a)][GetCollisionShape(b)];
+    return collide(a, b, contact);
+}
+
+bool CheckCollision(GameObject* a, GameObject* b)
+{
+    if (!a || !b || !a->hasCollision || !b->hasCollision) return false;
+    if (!CheckAABBCollision(a, b)) return false;
+
+    ContactInfo contact;
+    return ComputeContact(a, b, &contact);
+}
+
+void ResolvePlayerCollision(GameObject* player, GameObject* other)
+{
+    if (!player || !other) return;
+
+    ContactInfo contact;
+    if (ComputeContact(player, other, &contact))
+    {
+        ResolveContact(player, other, &contact);
+    }
 }
 
 void ResolveCollision(GameObject* a, GameObject* b)
+{
+    ContactInfo contact;
+    if (ComputeContact(a, b, &contact))
+    {
+        ResolveContact(a, b, &contact);
+    }
+}
+
+static void ResolvePlayerContact(GameObject* player, Vector3 normal, float depth)
+{
+    // normal points from the other body towards the player
+    player->position.x += normal.x * depth;
+    player->position.y += normal.y * depth;
+    player->position.z += normal.z * depth;
+
+    if (normal.y > 0.7f)
+    {
+        player->physics.isGrounded = true;
+        if (player->physics.velocity.y < 0) player->physics.velocity.y = 0;
+    }
+
+    float velocityDot = player->physics.velocity.x * normal.x +
+                       player->physics.velocity.z * normal.z;
+    if (velocityDot < 0)
+    {
+        player->physics.velocity.x -= normal.x * velocityDot * 0.8f;
+        player->physics.velocity.z -= normal.z * velocityDot * 0.8f;
+    }
+}
+
+static float GetInverseMass(GameObject* obj)
+{
+    if (obj->isStatic || !obj->hasPhysics) return 0.0f;
+    return (obj->physics.mass > 0) ? 1.0f / obj->physics.mass : 1.0f;
+}
+
+void ResolveContact(GameObject* a, GameObject* b, const ContactInfo* contact)
 {
     if (a->isTrigger || b->isTrigger) return;
-    
+
+    Vector3 n = contact->normal;
+
     if (a->type == OBJ_PLAYER)
     {
-        ResolvePlayerCollision(a, b);
+        ResolvePlayerContact(a, (Vector3){-n.x, -n.y, -n.z}, contact->depth);
         return;
     }
     if (b->type == OBJ_PLAYER)
     {
-        ResolvePlayerCollision(b, a);
+        ResolvePlayerContact(b, n, contact->depth);
         return;
     }
+
+    float invA = GetInverseMass(a);
+    float invB = GetInverseMass(b);
+    float invSum = invA + invB;
+    if (invSum <= 0) return;
+
+    float moveA = contact->depth * invA / invSum;
+    float moveB = contact->depth * invB / invSum;
+
+    a->position.x -= n.x * moveA;
+    a->position.y -= n.y * moveA;
+    a->position.z -= n.z * moveA;
+
+    b->position.x += n.x * moveB;
+    b->position.y += n.y * moveB;
+    b->position.z += n.z * moveB;
+
+    Vector3 va = a->physics.velocity;
+    Vector3 vb = b->physics.velocity;
+    float approach = (vb.x - va.x) * n.x + (vb.y - va.y) * n.y + (vb.z - va.z) * n.z;
+
+    if (approach < 0)
+    {
+        float bounce = fminf(invA > 0 ? a->physics.bounceFactor : 1.0f,
+                             invB > 0 ? b->physics.bounceFactor : 1.0f);
+        float impulse = -(1.0f + bounce) * approach / invSum;
+
+        a->physics.velocity.x -= n.x * impulse * invA;
+        a->physics.velocity.y -= n.y * impulse * invA;
+        a->physics.velocity.z -= n.z * impulse * invA;
+
+        b->physics.velocity.x += n.x * impulse * invB;
+        b->physics.velocity.y += n.y * impulse * invB;
+        b->physics.velocity.z += n.z * impulse * invB;
+    }
+
+    if (n.y > 0.7f && invB > 0) b->physics.isGrounded = true;
+    if (n.y < -0.7f && invA > 0) a->physics.isGrounded = true;
+}
+
+PhysicsStats* GetPhysicsStats()
+{
+    if (IsPhysicsThreadRunning()) return GetPhysicsThreadStats();
+    return &physicsStats;
+}
+
+PhysicsContact* GetPhysicsContacts(int* count)
+{
+    if (IsPhysicsThreadRunning()) return GetPhysicsThreadContacts(count);
     
-    float dx = b->position.x - a->position.x;
-    float dy = b->position.y - a->position.y;
-    float dz = b->position.z - a->position.z;
-    float distance = sqrtf(dx*dx + dy*dy + dz*dz);
-    if (distance == 0) return;
-    
-    float minDistance = (a->size.x + b->size.x) / 4;
-    float overlap = minDistance - distance;
+    if (count) *count = contactCount;
+    return contacts;
+}
+
+void CopyPhysicsResults(PhysicsStats* stats, PhysicsContact* outContacts, int* count)
+{
+    *stats = physicsStats;
+    for (int i = 0; i < contactCount; i++)
+    {
+        outContacts[i] = contacts[i];
+    }
+    *count = contactCount;
+}
+
+void RestorePhysicsResults(const PhysicsStats* stats, const PhysicsContact* inContacts, int count)
+{
+    if (count > MAX_CONTACTS) count = MAX_CONTACTS;
     
-    if (overlap > 0)
+    physicsStats = *stats;
+    for (int i = 0; i < count; i++)
     {
-        Vector3 normal = (Vector3){dx/distance, dy/distance, dz/distance};
-        
-        if (!a->isStatic)
-        {
-            a->position.x -= normal.x * overlap * 0.5f;
-            a->position.y -= normal.y * overlap * 0.5f;
-            a->position.z -= normal.z * overlap * 0.5f;
-        }
-        
-        if (!b->isStatic)
-        {
-            b->position.x += normal.x * overlap * 0.5f;
-            b->position.y += normal.y * overlap * 0.5f;
-            b->position.z += normal.z * overlap * 0.5f;
-        }
+        contacts[i] = inContacts[i];
     }
-}
\ No newline at end of file
+    contactCount = count;
+}
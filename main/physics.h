@@ -35,6 +35,39 @@ typedef struct
 
 typedef struct GameObject GameObject;
 
+typedef enum
+{
+    SHAPE_SPHERE,
+    SHAPE_BOX,
+    SHAPE_CAPSULE,
+    SHAPE_COUNT
+} CollisionShape;
+
+typedef struct
+{
+    Vector3 normal;     // Unit normal pointing from the first body to the second
+    float depth;        // Penetration depth along the normal
+    Vector3 point;      // Approximate contact point in world space
+} ContactInfo;
+
+typedef struct
+{
+    int bodyA;          // Index of the first body in the simulated array
+    int bodyB;
+    ContactInfo info;
+} PhysicsContact;
+
+typedef struct
+{
+    int pairsTested;
+    int broadphaseRejects;
+    int narrowphaseTests;
+    int narrowphaseRejects;   // AABBs overlapped but the exact shapes did not
+    int contacts;
+} PhysicsStats;
+
+#define MAX_CONTACTS 1024
+
 void InitPhysics();
 void SetGravity(float gravity);
 void SetPlayerPhysicsSettings(float walkSpeed, float runSpeed, float jumpForce, 
@@ -43,8 +76,13 @@ void SetPlayerPhysicsSettings(float walkSpeed, float runSpeed, float jumpForce,
 
 void UpdatePhysics(float deltaTime);
 void UpdatePlayerPhysics(float deltaTime);
+void SimulatePhysics(GameObject** objects, int objectCount,
+                     const PlayerPhysicsSettings* settings, float deltaTime);
+void SimulatePlayerPhysics(GameObject* player, const PlayerPhysicsSettings* settings, float deltaTime);
 void ApplyForce(GameObject* obj, Vector3 force);
 
+CollisionShape GetCollisionShape(GameObject* obj);
+bool ComputeContact(GameObject* a, GameObject* b, ContactInfo* contact);
 bool CheckCollision(GameObject* a, GameObject* b);
 bool CheckAABBCollision(GameObject* a, GameObject* b);
 bool CheckSphereAABBCollision(Vector3 sphereCenter, float sphereRadius, GameObject* box);
@@ -53,5 +91,11 @@ bool CheckSphereCollision(Vector3 c1, float r1, Vector3 c2, float r2);
 void ApplyPhysicsToObject(GameObject* obj, float dt);
 void ResolveCollision(GameObject* a, GameObject* b);
 void ResolvePlayerCollision(GameObject* player, GameObject* other);
+void ResolveContact(GameObject* a, GameObject* b, const ContactInfo* contact);
+
+PhysicsStats* GetPhysicsStats();
+PhysicsContact* GetPhysicsContacts(int* count);
+void CopyPhysicsResults(PhysicsStats* stats, PhysicsContact* outContacts, int* count);
+void RestorePhysicsResults(const PhysicsStats* stats, const PhysicsContact* inContacts, int count);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Physics Snapshot Implementation
+//==================================================================
+
+#include "physics_snapshot.h"
+#include "engine.h"
+#include <string.h>
+
+static size_t SnapshotSize(int bodyCount, int contactCount)
+{
+    return sizeof(PhysicsSnapshotHeader) +
+           (size_t)bodyCount * sizeof(PhysicsSnapshotBody) +
+           (size_t)contactCount * sizeof(PhysicsContact);
+}
+
+size_t GetPhysicsSnapshotSize()
+{
+    int contactCount = 0;
+    GetPhysicsContacts(&contactCount);
+    return SnapshotSize(*GetObjectCount(), contactCount);
+}
+
+size_t SavePhysicsSnapshot(void* buffer, size_t capacity)
+{
+    if (IsPhysicsThreadRunning())
+    {
+        printf("Warning: Cannot snapshot physics while the physics thread is running\n");
+        return 0;
+    }
+
+    GameObject** objects = GetObjects();
+    int objectCount = *GetObjectCount();
+    int contactCount = 0;
+    PhysicsContact* contacts = GetPhysicsContacts(&contactCount);
+
+    size_t size = SnapshotSize(objectCount, contactCount);
+    if (!buffer || capacity < size)
+    {
+        printf("Warning: Physics snapshot needs %zu bytes, buffer has %zu\n", size, capacity);
+        return 0;
+    }
+
+    // Records are cleared first so their padding is zero and two saves of
+    // the same world compare and hash equal
+    PhysicsSnapshotHeader* header = (PhysicsSnapshotHeader*)buffer;
+    memset(header, 0, sizeof(PhysicsSnapshotHeader));
+    header->magic = PHYSICS_SNAPSHOT_MAGIC;
+    header->version = PHYSICS_SNAPSHOT_VERSION;
+    header->size = (unsigned int)size;
+    header->bodyCount = objectCount;
+    header->contactCount = contactCount;
+    header->playerIndex = -1;
+    header->settings = *GetPlayerSettings();
+    header->stats = *GetPhysicsStats();
+
+    PhysicsSnapshotBody* body = (PhysicsSnapshotBody*)(header + 1);
+    for (int i = 0; i < objectCount; i++, body++)
+    {
+        const PhysicsProperties* physics = &objects[i]->physics;
+
+        memset(body, 0, sizeof(PhysicsSnapshotBody));
+        body->position = objects[i]->position;
+        body->physics.mass = physics->mass;
+        body->physics.velocity = physics->velocity;
+        body->physics.acceleration = physics->acceleration;
+        body->physics.isGrounded = physics->isGrounded;
+        body->physics.bounceFactor = physics->bounceFactor;
+        body->physics.friction = physics->friction;
+        body->isActive = objects[i]->isActive;
+
+        if (objects[i] == *GetPlayerObject()) header->playerIndex = i;
+    }
+
+    memcpy(body, contacts, (size_t)contactCount * sizeof(PhysicsContact));
+    return size;
+}
+
+bool RestorePhysicsSnapshot(const void* buffer, size_t size)
+{
+    if (IsPhysicsThreadRunning())
+    {
+        printf("Warning: Cannot restore physics while the physics thread is running\n");
+        return false;
+    }
+
+    const PhysicsSnapshotHeader* header = (const PhysicsSnapshotHeader*)buffer;
+    if (!buffer || size < sizeof(PhysicsSnapshotHeader) ||
+        header->magic != PHYSICS_SNAPSHOT_MAGIC)
+    {
+        printf("Warning: Invalid physics snapshot\n");
+        return false;
+    }
+
+    if (header->version != PHYSICS_SNAPSHOT_VERSION)
+    {
+        printf("Warning: Unsupported physics snapshot version %u\n", header->version);
+        return false;
+    }
+
+    if (header->bodyCount < 0 || header->contactCount < 0 ||
+        header->contactCount > MAX_CONTACTS ||
+        header->playerIndex < -1 || header->playerIndex >= header->bodyCount ||
+        header->size != SnapshotSize(header->bodyCount, header->contactCount) ||
+        header->size > size)
+    {
+        printf("Warning: Corrupt physics snapshot\n");
+        return false;
+    }
+
+    GameObject** objects = GetObjects();
+    if (header->bodyCount != *GetObjectCount())
+    {
+        printf("Warning: Physics snapshot has %d bodies, world has %d\n",
+               header->bodyCount, *GetObjectCount());
+        return false;
+    }
+
+    *GetPlayerSettings() = header->settings;
+    *GetPlayerObject() = (header->playerIndex >= 0) ? objects[header->playerIndex] : NULL;
+
+    const PhysicsSnapshotBody* body = (const PhysicsSnapshotBody*)(header + 1);
+    for (int i = 0; i < header->bodyCount; i++, body++)
+    {
+        objects[i]->position = body->position;
+        objects[i]->physics = body->physics;
+        objects[i]->isActive = body->isActive;
+    }
+
+    RestorePhysicsResults(&header->stats, (const PhysicsContact*)body, header->contactCount);
+    return true;
+}
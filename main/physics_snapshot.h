@@ -0,0 +1,43 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Physics Snapshot Module
+//==================================================================
+
+#ifndef PHYSICS_SNAPSHOT_H
+#define PHYSICS_SNAPSHOT_H
+
+#include "physics.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#define PHYSICS_SNAPSHOT_MAGIC 0x53505751u
+#define PHYSICS_SNAPSHOT_VERSION 1
+
+typedef struct
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned int size;
+    int bodyCount;
+    int contactCount;
+    int playerIndex;
+    PlayerPhysicsSettings settings;
+    PhysicsStats stats;
+} PhysicsSnapshotHeader;
+
+typedef struct
+{
+    Vector3 position;
+    PhysicsProperties physics;
+    bool isActive;
+} PhysicsSnapshotBody;
+
+// Bodies are matched by their index in GetObjects(), so a snapshot can
+// only be restored into the same set of objects it was taken from.
+size_t GetPhysicsSnapshotSize();
+size_t SavePhysicsSnapshot(void* buffer, size_t capacity);
+bool RestorePhysicsSnapshot(const void* buffer, size_t size);
+
+#endif
@@ -0,0 +1,651 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Physics Thread Implementation
+//==================================================================
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "physics_thread.h"
+#include "engine.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+typedef enum
+{
+    CMD_ADD_BODY,
+    CMD_REMOVE_BODY,
+    CMD_SYNC_BODY,
+    CMD_SET_POSITION,
+    CMD_SET_VELOCITY,
+    CMD_SET_GROUNDED,
+    CMD_APPLY_FORCE,
+    CMD_SET_SETTINGS
+} PhysicsCommandType;
+
+typedef struct
+{
+    PhysicsCommandType type;
+    unsigned int seq;
+    int slot;
+    unsigned int generation;
+    int mask;
+    Vector3 value;
+    bool flag;
+    GameObject body;
+    PlayerPhysicsSettings settings;
+} PhysicsCommand;
+
+typedef struct
+{
+    Vector3 position;
+    Vector3 velocity;
+    bool isGrounded;
+    unsigned int generation;
+} PublishedBody;
+
+typedef struct
+{
+    PublishedBody bodies[MAX_OBJECTS];
+    PhysicsStats stats;
+    PhysicsContact contacts[MAX_CONTACTS];
+    int contactCount;
+    unsigned int processedSeq;
+    unsigned int step;
+} PhysicsFrame;
+
+// Main thread bookkeeping for one registered body
+typedef struct
+{
+    GameObject* owner;
+    unsigned int generation;
+    Vector3 sentPosition;
+    Vector3 sentVelocity;
+    bool sentGrounded;
+    GameObject sentBody;
+    unsigned int positionSeq[3];
+    unsigned int velocitySeq[3];
+    unsigned int groundedSeq;
+} PhysicsSlot;
+
+#define FRAME_FRESH 4
+
+#if PHYSICS_COMMAND_CAPACITY < MAX_OBJECTS * 4 + 1 || (PHYSICS_COMMAND_CAPACITY & (PHYSICS_COMMAND_CAPACITY - 1))
+    #error "PHYSICS_COMMAND_CAPACITY must be a power of two holding one full sync of MAX_OBJECTS bodies"
+#endif
+
+static PhysicsCommand commands[PHYSICS_COMMAND_CAPACITY];
+static unsigned int commandHead = 0;
+static unsigned int commandTail = 0;
+
+static PhysicsFrame frames[3];
+static int sharedFrame = 1;
+static int writeFrame = 0;
+static int readFrame = 2;
+
+static PhysicsSlot slots[MAX_OBJECTS];
+static PlayerPhysicsSettings sentSettings;
+static unsigned int nextSeq = 0;
+
+// Owned by the physics thread while it runs
+static GameObject bodies[MAX_OBJECTS];
+static bool bodyActive[MAX_OBJECTS];
+static unsigned int bodyGeneration[MAX_OBJECTS];
+static PlayerPhysicsSettings threadSettings;
+static unsigned int processedSeq = 0;
+
+static PhysicsStats publishedStats = {0};
+static PhysicsContact publishedContacts[MAX_CONTACTS];
+static int publishedContactCount = 0;
+
+static PhysicsThreadStats threadInfo = {0};
+static pthread_t physicsThread;
+static bool threadRunning = false;
+static int stopRequested = 0;
+
+static double GetMonotonicTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void SleepSeconds(double seconds)
+{
+    if (seconds <= 0.0) return;
+
+    struct timespec ts;
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = (long)((seconds - (double)ts.tv_sec) * 1e9);
+    nanosleep(&ts, NULL);
+}
+
+static void PushCommand(PhysicsCommand* cmd)
+{
+    cmd->seq = ++nextSeq;
+
+    unsigned int head = commandHead;
+    while (head - __atomic_load_n(&commandTail, __ATOMIC_ACQUIRE) >= PHYSICS_COMMAND_CAPACITY)
+    {
+        // Queue full: the thread drains it at least once per step
+        threadInfo.commandStalls++;
+        SleepSeconds(0.0002);
+    }
+
+    commands[head % PHYSICS_COMMAND_CAPACITY] = *cmd;
+    __atomic_store_n(&commandHead, head + 1, __ATOMIC_RELEASE);
+    threadInfo.commandsSent++;
+}
+
+static void ApplyCommand(const PhysicsCommand* cmd)
+{
+    processedSeq = cmd->seq;
+
+    if (cmd->type == CMD_SET_SETTINGS)
+    {
+        threadSettings = cmd->settings;
+        return;
+    }
+
+    if (cmd->slot < 0 || cmd->slot >= MAX_OBJECTS) return;
+
+    GameObject* body = &bodies[cmd->slot];
+
+    if (cmd->type == CMD_ADD_BODY)
+    {
+        *body = cmd->body;
+        body->customData = NULL;
+        bodyActive[cmd->slot] = true;
+        bodyGeneration[cmd->slot] = cmd->generation;
+        return;
+    }
+
+    // Commands for a body that has since been removed or replaced
+    if (!bodyActive[cmd->slot] || bodyGeneration[cmd->slot] != cmd->generation) return;
+
+    switch (cmd->type)
+    {
+        case CMD_REMOVE_BODY:
+            bodyActive[cmd->slot] = false;
+            break;
+        case CMD_SYNC_BODY:
+        {
+            PhysicsProperties dynamic = body->physics;
+            Vector3 position = body->position;
+
+            *body = cmd->body;
+            body->customData = NULL;
+            body->position = position;
+            body->physics.velocity = dynamic.velocity;
+            body->physics.acceleration = dynamic.acceleration;
+            body->physics.isGrounded = dynamic.isGrounded;
+            break;
+        }
+        case CMD_SET_POSITION:
+            if (cmd->mask & 1) body->position.x = cmd->value.x;
+            if (cmd->mask & 2) body->position.y = cmd->value.y;
+            if (cmd->mask & 4) body->position.z = cmd->value.z;
+            break;
+        case CMD_SET_VELOCITY:
+            if (cmd->mask & 1) body->physics.velocity.x = cmd->value.x;
+            if (cmd->mask & 2) body->physics.velocity.y = cmd->value.y;
+            if (cmd->mask & 4) body->physics.velocity.z = cmd->value.z;
+            break;
+        case CMD_SET_GROUNDED:
+            body->physics.isGrounded = cmd->flag;
+            break;
+        case CMD_APPLY_FORCE:
+            body->physics.velocity.x += cmd->value.x / body->physics.mass;
+            body->physics.velocity.y += cmd->value.y / body->physics.mass;
+            body->physics.velocity.z += cmd->value.z / body->physics.mass;
+            break;
+        default:
+            break;
+    }
+}
+
+static int DrainCommands()
+{
+    unsigned int tail = commandTail;
+    unsigned int head = __atomic_load_n(&commandHead, __ATOMIC_ACQUIRE);
+    int processed = 0;
+
+    while (tail != head)
+    {
+        ApplyCommand(&commands[tail % PHYSICS_COMMAND_CAPACITY]);
+        tail++;
+        processed++;
+    }
+
+    __atomic_store_n(&commandTail, tail, __ATOMIC_RELEASE);
+    return processed;
+}
+
+static void StepBodies(float dt)
+{
+    static GameObject* simulated[MAX_OBJECTS];
+    int count = 0;
+    GameObject* player = NULL;
+
+    for (int i = 0; i < MAX_OBJECTS; i++)
+    {
+        if (!bodyActive[i]) continue;
+
+        simulated[count++] = &bodies[i];
+        if (bodies[i].type == OBJ_PLAYER) player = &bodies[i];
+    }
+
+    SimulatePhysics(simulated, count, &threadSettings, dt);
+    SimulatePlayerPhysics(player, &threadSettings, dt);
+}
+
+static void PublishFrame()
+{
+    PhysicsFrame* frame = &frames[writeFrame];
+    static int slotOfIndex[MAX_OBJECTS];
+    int count = 0;
+
+    for (int i = 0; i < MAX_OBJECTS; i++)
+    {
+        PublishedBody* out = &frame->bodies[i];
+
+        if (!bodyActive[i])
+        {
+            out->generation = 0;
+            continue;
+        }
+
+        slotOfIndex[count++] = i;
+        out->position = bodies[i].position;
+        out->velocity = bodies[i].physics.velocity;
+        out->isGrounded = bodies[i].physics.isGrounded;
+        out->generation = bodyGeneration[i];
+    }
+
+    // Contacts index the simulated array; publish them by slot instead
+    CopyPhysicsResults(&frame->stats, frame->contacts, &frame->contactCount);
+    for (int i = 0; i < frame->contactCount; i++)
+    {
+        frame->contacts[i].bodyA = slotOfIndex[frame->contacts[i].bodyA];
+        frame->contacts[i].bodyB = slotOfIndex[frame->contacts[i].bodyB];
+    }
+
+    frame->processedSeq = processedSeq;
+    frame->step = threadInfo.stepsSimulated;
+
+    int previous = __atomic_exchange_n(&sharedFrame, writeFrame | FRAME_FRESH, __ATOMIC_ACQ_REL);
+    writeFrame = previous & 3;
+    threadInfo.framesPublished++;
+}
+
+static void* PhysicsThreadMain(void* arg)
+{
+    (void)arg;
+
+    double step = 1.0 / (double)threadInfo.stepRate;
+    double last = GetMonotonicTime();
+    double accumulator = 0.0;
+
+    while (!__atomic_load_n(&stopRequested, __ATOMIC_ACQUIRE))
+    {
+        int processed = DrainCommands();
+
+        double now = GetMonotonicTime();
+        accumulator += now - last;
+        last = now;
+
+        // Drop time we cannot catch up on instead of spiralling
+        if (accumulator > step * PHYSICS_MAX_SUBSTEPS)
+        {
+            accumulator = step * PHYSICS_MAX_SUBSTEPS;
+        }
+
+        bool stepped = false;
+        while (accumulator >= step)
+        {
+            double start = GetMonotonicTime();
+            StepBodies((float)step);
+            threadInfo.lastStepMs = (float)((GetMonotonicTime() - start) * 1000.0);
+            threadInfo.stepsSimulated++;
+            accumulator -= step;
+            stepped = true;
+        }
+
+        if (stepped || processed > 0)
+        {
+            PublishFrame();
+        }
+
+        SleepSeconds(step - accumulator);
+    }
+
+    return NULL;
+}
+
+static int FindSlot(GameObject* obj)
+{
+    for (int i = 0; i < MAX_OBJECTS; i++)
+    {
+        if (slots[i].owner == obj) return i;
+    }
+    return -1;
+}
+
+static int FindObjectIndex(GameObject* obj)
+{
+    GameObject** objects = GetObjects();
+    int objectCount = *GetObjectCount();
+
+    for (int i = 0; i < objectCount; i++)
+    {
+        if (objects[i] == obj) return i;
+    }
+    return -1;
+}
+
+static void SendBody(int slot, PhysicsCommandType type)
+{
+    PhysicsSlot* s = &slots[slot];
+    PhysicsCommand cmd = {0};
+
+    cmd.type = type;
+    cmd.slot = slot;
+    cmd.generation = s->generation;
+    cmd.body = *s->owner;
+    PushCommand(&cmd);
+
+    s->sentBody = *s->owner;
+    if (type == CMD_ADD_BODY)
+    {
+        s->sentPosition = s->owner->position;
+        s->sentVelocity = s->owner->physics.velocity;
+        s->sentGrounded = s->owner->physics.isGrounded;
+    }
+}
+
+// Anything besides the streamed dynamic state that changes collision behaviour
+static bool BodyPropertiesChanged(const GameObject* a, const GameObject* b)
+{
+    return a->type != b->type || a->isActive != b->isActive ||
+           a->hasPhysics != b->hasPhysics || a->hasCollision != b->hasCollision ||
+           a->isStatic != b->isStatic || a->isTrigger != b->isTrigger ||
+           a->size.x != b->size.x || a->size.y != b->size.y || a->size.z != b->size.z ||
+           a->physics.mass != b->physics.mass ||
+           a->physics.bounceFactor != b->physics.bounceFactor ||
+           a->physics.friction != b->physics.friction;
+}
+
+static void SendVectorChanges(int slot, PhysicsCommandType type, Vector3 current,
+                              Vector3* sent, unsigned int* pendingSeq)
+{
+    int mask = 0;
+    if (current.x != sent->x) mask |= 1;
+    if (current.y != sent->y) mask |= 2;
+    if (current.z != sent->z) mask |= 4;
+    if (!mask) return;
+
+    PhysicsCommand cmd = {0};
+    cmd.type = type;
+    cmd.slot = slot;
+    cmd.generation = slots[slot].generation;
+    cmd.mask = mask;
+    cmd.value = current;
+    PushCommand(&cmd);
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (mask & (1 << i)) pendingSeq[i] = cmd.seq;
+    }
+    *sent = current;
+}
+
+static void ApplyPublishedComponent(float* local, float* sent, float published,
+                                    unsigned int pendingSeq, unsigned int frameSeq)
+{
+    // Keep a local write until the thread has seen it
+    if (pendingSeq > frameSeq) return;
+    *local = published;
+    *sent = published;
+}
+
+bool StartPhysicsThread(int stepRate)
+{
+    if (threadRunning) return true;
+    if (stepRate <= 0) stepRate = PHYSICS_THREAD_DEFAULT_RATE;
+
+    memset(slots, 0, sizeof(slots));
+    memset(bodyActive, 0, sizeof(bodyActive));
+    memset(frames, 0, sizeof(frames));
+    commandHead = 0;
+    commandTail = 0;
+    sharedFrame = 1;
+    writeFrame = 0;
+    readFrame = 2;
+    nextSeq = 0;
+    processedSeq = 0;
+    stopRequested = 0;
+    publishedStats = (PhysicsStats){0};
+    publishedContactCount = 0;
+    threadInfo = (PhysicsThreadStats){0};
+    threadInfo.stepRate = stepRate;
+
+    // Seed the thread with the current world before it starts stepping
+    sentSettings = *GetPlayerSettings();
+    threadSettings = sentSettings;
+    threadRunning = true;
+
+    GameObject** objects = GetObjects();
+    int objectCount = *GetObjectCount();
+    for (int i = 0; i < objectCount; i++)
+    {
+        RegisterPhysicsBody(objects[i]);
+    }
+
+    if (pthread_create(&physicsThread, NULL, PhysicsThreadMain, NULL) != 0)
+    {
+        printf("Warning: Failed to start physics thread, using main thread physics\n");
+        threadRunning = false;
+        return false;
+    }
+
+    printf("Physics thread started (%d Hz)\n", stepRate);
+    return true;
+}
+
+void StopPhysicsThread()
+{
+    if (!threadRunning) return;
+
+    __atomic_store_n(&stopRequested, 1, __ATOMIC_RELEASE);
+    pthread_join(physicsThread, NULL);
+
+    // The thread is gone: apply what it never got to and take its state back
+    DrainCommands();
+
+    for (int i = 0; i < MAX_OBJECTS; i++)
+    {
+        GameObject* owner = slots[i].owner;
+        if (!owner || !bodyActive[i]) continue;
+
+        owner->position = bodies[i].position;
+        owner->physics.velocity = bodies[i].physics.velocity;
+        owner->physics.isGrounded = bodies[i].physics.isGrounded;
+    }
+
+    memset(slots, 0, sizeof(slots));
+    threadRunning = false;
+
+    printf("Physics thread stopped after %u steps\n", threadInfo.stepsSimulated);
+}
+
+bool IsPhysicsThreadRunning()
+{
+    return threadRunning;
+}
+
+void RegisterPhysicsBody(GameObject* obj)
+{
+    if (!threadRunning || !obj || FindSlot(obj) >= 0) return;
+
+    int slot = FindSlot(NULL);
+    if (slot < 0)
+    {
+        printf("Warning: No free physics thread slot for %s\n", obj->name);
+        return;
+    }
+
+    unsigned int generation = slots[slot].generation + 1;
+    memset(&slots[slot], 0, sizeof(PhysicsSlot));
+    slots[slot].owner = obj;
+    slots[slot].generation = generation;
+    SendBody(slot, CMD_ADD_BODY);
+}
+
+void UnregisterPhysicsBody(GameObject* obj)
+{
+    if (!threadRunning || !obj) return;
+
+    int slot = FindSlot(obj);
+    if (slot < 0) return;
+
+    PhysicsCommand cmd = {0};
+    cmd.type = CMD_REMOVE_BODY;
+    cmd.slot = slot;
+    cmd.generation = slots[slot].generation;
+    PushCommand(&cmd);
+
+    slots[slot].owner = NULL;
+}
+
+bool QueuePhysicsForce(GameObject* obj, Vector3 force)
+{
+    if (!threadRunning) return false;
+
+    int slot = FindSlot(obj);
+    if (slot < 0) return false;
+
+    PhysicsCommand cmd = {0};
+    cmd.type = CMD_APPLY_FORCE;
+    cmd.slot = slot;
+    cmd.generation = slots[slot].generation;
+    cmd.value = force;
+    PushCommand(&cmd);
+    return true;
+}
+
+bool QueuePhysicsPosition(GameObject* obj)
+{
+    if (!threadRunning) return false;
+
+    int slot = FindSlot(obj);
+    if (slot < 0) return false;
+
+    SendVectorChanges(slot, CMD_SET_POSITION, obj->position,
+                      &slots[slot].sentPosition, slots[slot].positionSeq);
+    return true;
+}
+
+void SyncPhysicsThread()
+{
+    if (!threadRunning) return;
+
+    PlayerPhysicsSettings* settings = GetPlayerSettings();
+    if (memcmp(settings, &sentSettings, sizeof(PlayerPhysicsSettings)) != 0)
+    {
+        PhysicsCommand cmd = {0};
+        cmd.type = CMD_SET_SETTINGS;
+        cmd.settings = *settings;
+        PushCommand(&cmd);
+        sentSettings = *settings;
+    }
+
+    // Forward direct field writes made since the last sync
+    for (int i = 0; i < MAX_OBJECTS; i++)
+    {
+        PhysicsSlot* s = &slots[i];
+        GameObject* owner = s->owner;
+        if (!owner) continue;
+
+        if (BodyPropertiesChanged(owner, &s->sentBody))
+        {
+            SendBody(i, CMD_SYNC_BODY);
+        }
+
+        SendVectorChanges(i, CMD_SET_POSITION, owner->position, &s->sentPosition, s->positionSeq);
+        SendVectorChanges(i, CMD_SET_VELOCITY, owner->physics.velocity, &s->sentVelocity, s->velocitySeq);
+
+        if (owner->physics.isGrounded != s->sentGrounded)
+        {
+            PhysicsCommand cmd = {0};
+            cmd.type = CMD_SET_GROUNDED;
+            cmd.slot = i;
+            cmd.generation = s->generation;
+            cmd.flag = owner->physics.isGrounded;
+            PushCommand(&cmd);
+
+            s->groundedSeq = cmd.seq;
+            s->sentGrounded = owner->physics.isGrounded;
+        }
+    }
+
+    if (!(__atomic_load_n(&sharedFrame, __ATOMIC_ACQUIRE) & FRAME_FRESH)) return;
+
+    int previous = __atomic_exchange_n(&sharedFrame, readFrame, __ATOMIC_ACQ_REL);
+    readFrame = previous & 3;
+    threadInfo.framesConsumed++;
+
+    const PhysicsFrame* frame = &frames[readFrame];
+    unsigned int seq = frame->processedSeq;
+
+    for (int i = 0; i < MAX_OBJECTS; i++)
+    {
+        PhysicsSlot* s = &slots[i];
+        const PublishedBody* body = &frame->bodies[i];
+        GameObject* owner = s->owner;
+        if (!owner || body->generation != s->generation) continue;
+
+        ApplyPublishedComponent(&owner->position.x, &s->sentPosition.x, body->position.x, s->positionSeq[0], seq);
+        ApplyPublishedComponent(&owner->position.y, &s->sentPosition.y, body->position.y, s->positionSeq[1], seq);
+        ApplyPublishedComponent(&owner->position.z, &s->sentPosition.z, body->position.z, s->positionSeq[2], seq);
+        ApplyPublishedComponent(&owner->physics.velocity.x, &s->sentVelocity.x, body->velocity.x, s->velocitySeq[0], seq);
+        ApplyPublishedComponent(&owner->physics.velocity.y, &s->sentVelocity.y, body->velocity.y, s->velocitySeq[1], seq);
+        ApplyPublishedComponent(&owner->physics.velocity.z, &s->sentVelocity.z, body->velocity.z, s->velocitySeq[2], seq);
+
+        if (s->groundedSeq <= seq)
+        {
+            owner->physics.isGrounded = body->isGrounded;
+            s->sentGrounded = body->isGrounded;
+        }
+    }
+
+    // Contacts arrive by slot; hand them out as indices into GetObjects()
+    publishedStats = frame->stats;
+    publishedContactCount = 0;
+    for (int i = 0; i < frame->contactCount; i++)
+    {
+        PhysicsContact contact = frame->contacts[i];
+        contact.bodyA = FindObjectIndex(slots[contact.bodyA].owner);
+        contact.bodyB = FindObjectIndex(slots[contact.bodyB].owner);
+        if (contact.bodyA < 0 || contact.bodyB < 0) continue;
+
+        publishedContacts[publishedContactCount++] = contact;
+    }
+}
+
+PhysicsStats* GetPhysicsThreadStats()
+{
+    return &publishedStats;
+}
+
+PhysicsContact* GetPhysicsThreadContacts(int* count)
+{
+    if (count) *count = publishedContactCount;
+    return publishedContacts;
+}
+
+PhysicsThreadStats* GetPhysicsThreadInfo()
+{
+    return &threadInfo;
+}
@@ -0,0 +1,52 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Physics Thread Module
+//==================================================================
+
+#ifndef PHYSICS_THREAD_H
+#define PHYSICS_THREAD_H
+
+#include "raylib.h"
+#include "physics.h"
+#include <stdbool.h>
+
+#define PHYSICS_THREAD_DEFAULT_RATE 120
+// Holds a full SyncPhysicsThread (up to four commands per body plus the
+// settings) so the main thread never waits on a step; a power of two so
+// the free-running indices wrap cleanly
+#define PHYSICS_COMMAND_CAPACITY 4096
+#define PHYSICS_MAX_SUBSTEPS 8
+
+typedef struct
+{
+    int stepRate;
+    unsigned int stepsSimulated;
+    unsigned int framesPublished;
+    unsigned int framesConsumed;
+    unsigned int commandsSent;
+    unsigned int commandStalls;    // times a full queue made the main thread wait
+    float lastStepMs;
+} PhysicsThreadStats;
+
+// Opt-in: while running, the thread owns the simulation at a fixed step
+// and the main thread only exchanges commands and published frames.
+bool StartPhysicsThread(int stepRate);
+void StopPhysicsThread();
+bool IsPhysicsThreadRunning();
+
+// Called once per frame on the main thread: forwards direct writes to
+// position/velocity/isGrounded and applies the latest published frame.
+void SyncPhysicsThread();
+
+void RegisterPhysicsBody(GameObject* obj);
+void UnregisterPhysicsBody(GameObject* obj);
+bool QueuePhysicsForce(GameObject* obj, Vector3 force);
+bool QueuePhysicsPosition(GameObject* obj);
+
+PhysicsStats* GetPhysicsThreadStats();
+PhysicsContact* GetPhysicsThreadContacts(int* count);
+PhysicsThreadStats* GetPhysicsThreadInfo();
+
+#endif
@@ -0,0 +1,590 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Render Implementation
+//==================================================================
+
+#include "render.h"
+#include "render_pipeline.h"
+#include "engine.h"
+#include "instancing.h"
+#include "culling.h"
+#include "lod.h"
+#include "static_batch.h"
+#include "fog.h"
+#include "shadows.h"
+#include "lights.h"
+#include "impostors.h"
+#include "command_list.h"
+#include "texture_atlas.h"
+#include "debug_draw.h"
+#include "gpu_timers.h"
+#include "resolution.h"
+#include "physics.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// Sort key, high to low bits:
+//   pass (2) | transparent (1) | opaque:      shader (4) texture (16) mesh (8) ... depth (24)
+//                              | transparent: far-to-near depth (24) shader (4) texture (16) mesh (8)
+#define KEY_PASS_SHIFT 62
+#define KEY_TRANSPARENT_SHIFT 61
+#define KEY_DEPTH_BITS 24
+#define KEY_DEPTH_MAX ((1u << KEY_DEPTH_BITS) - 1)
+
+// A cross-fading object queues both its mesh and its impostor
+#define RENDER_FRAME_ITEMS (MAX_OBJECTS * 2)
+
+typedef struct
+{
+    uint64_t key;
+    int object;
+    MeshPrimitive primitive;
+    int lod;
+    unsigned int textureId;
+    int shader;
+} RenderItem;
+
+typedef struct
+{
+    int shader;
+    MeshPrimitive primitive;
+    int lod;
+    unsigned int textureId;
+    int firstInstance;
+    int instanceCount;
+} RenderRun;
+
+// The recorder's queue, sorted in place into runs of identical state.
+// Only one frame records at a time, so one queue serves every slot.
+typedef struct
+{
+    RenderItem items[RENDER_FRAME_ITEMS];
+    RenderItem sortScratch[RENDER_FRAME_ITEMS];
+    InstanceData sources[RENDER_FRAME_ITEMS];
+    int itemCount;
+
+    RenderRun runs[RENDER_FRAME_ITEMS];
+    InstanceData instances[RENDER_FRAME_ITEMS];
+    int runCount;
+    int stateChanges;
+} RenderFrame;
+
+// Same inputs/uniforms as raylib's default shader, plus fog and shadows
+static const char* meshVertexShader =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec3 vertexNormal;\n"
+    "in vec4 vertexColor;\n"
+    "uniform mat4 mvp;\n"
+    "uniform mat4 matModel;\n"
+    "uniform mat4 matNormal;\n"
+    "out vec3 fragPosition;\n"
+    "out vec3 fragNormal;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec4 fragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    fragPosition = vec3(matModel*vec4(vertexPosition, 1.0));\n"
+    "    fragNormal = mat3(matNormal)*vertexNormal;\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragColor = vertexColor;\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char* meshFragmentShader =
+    "#version 330\n"
+    "in vec3 fragPosition;\n"
+    "in vec3 fragNormal;\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    FOG_SHADER_GLSL
+    SHADOW_SHADER_GLSL
+    LIGHT_SHADER_GLSL
+    "void main()\n"
+    "{\n"
+    "    vec4 color = texture(texture0, fragTexCoord)*colDiffuse*fragColor;\n"
+    "    vec3 albedo = color.rgb;\n"
+    "    color.rgb = mix(color.rgb, shadowColor.rgb, ShadowAmount(fragPosition, fragNormal));\n"
+    "    color.rgb += ClusterLighting(fragPosition, fragNormal, albedo);\n"
+    "    finalColor = vec4(mix(fogColor.rgb, color.rgb, FogFactor(fragPosition)), color.a);\n"
+    "}\n";
+
+static Shader meshShader = {0};
+static bool meshShaderLoaded = false;
+
+static RenderStats renderStats = {0};
+static RenderFrame renderFrame;
+
+void InitRender()
+{
+    InitInstancing();
+    renderStats = (RenderStats){0};
+}
+
+void CloseRender()
+{
+    CloseStaticBatches();
+    CloseInstancing();
+
+    if (meshShaderLoaded && meshShader.id != rlGetShaderIdDefault())
+    {
+        UnregisterFogShader(meshShader);
+        UnregisterShadowShader(meshShader);
+        UnregisterLightShader(meshShader);
+        UnloadShader(meshShader);
+    }
+    meshShader = (Shader){0};
+    meshShaderLoaded = false;
+}
+
+Shader GetRenderMeshShader()
+{
+    if (!meshShaderLoaded)
+    {
+        meshShaderLoaded = true;
+        if (rlGetVersion() >= RL_OPENGL_33)
+        {
+            meshShader = LoadShaderFromMemory(meshVertexShader, meshFragmentShader);
+        }
+
+        if (meshShader.id == 0 || meshShader.id == rlGetShaderIdDefault())
+        {
+            meshShader = (Shader){ rlGetShaderIdDefault(), rlGetShaderLocsDefault() };
+        }
+        else
+        {
+            RegisterFogShader(meshShader);
+            RegisterShadowShader(meshShader);
+            RegisterLightShader(meshShader);
+        }
+    }
+
+    return meshShader;
+}
+
+MeshPrimitive GetObjectPrimitive(const GameObject* obj, Vector3* position, Vector3* scale)
+{
+    *position = obj->position;
+    *scale = obj->size;
+
+    switch (obj->type)
+    {
+        case OBJ_SPHERE:
+            *scale = (Vector3){obj->size.x, obj->size.x, obj->size.x};
+            return MESH_SPHERE;
+        case OBJ_CYLINDER:
+            scale->z = obj->size.x;
+            return MESH_CYLINDER;
+        case OBJ_CONE:
+            scale->z = obj->size.x;
+            return MESH_CONE;
+        case OBJ_PYRAMID:
+            scale->y = obj->size.y * 0.7f;
+            return MESH_CUBE;
+        default:
+            return MESH_CUBE;
+    }
+}
+
+Color GetObjectDrawColor(const GameObject* obj, unsigned int* textureId)
+{
+    bool boxShaped = (obj->type == OBJ_CUBE || obj->type == OBJ_PLANE);
+    *textureId = 0;
+
+    // Only cubes and planes carry UVs worth texturing, as in DrawObject
+    if (obj->hasMaterial && obj->material.diffuseMap.id != 0)
+    {
+        if (!boxShaped) return obj->material.color;
+        *textureId = obj->material.diffuseMap.id;
+        return WHITE;
+    }
+
+    if (obj->hasTexture && obj->texture.id != 0)
+    {
+        if (!boxShaped) return obj->color;
+        *textureId = obj->texture.id;
+        return WHITE;
+    }
+
+    return obj->hasMaterial ? obj->material.color : obj->color;
+}
+
+RenderView MakeRenderView(Camera3D camera, int width, int height)
+{
+    RenderView view = {0};
+    view.camera = camera;
+    view.aspect = (float)width / (float)(height > 0 ? height : 1);
+
+    double top = (camera.projection == CAMERA_PERSPECTIVE) ?
+                 RL_CULL_DISTANCE_NEAR * tan(camera.fovy * 0.5 * DEG2RAD) : camera.fovy * 0.5;
+    double right = top * view.aspect;
+
+    if (camera.projection == CAMERA_PERSPECTIVE)
+    {
+        view.projection = MatrixFrustum(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+    else
+    {
+        view.projection = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+
+    view.view = MatrixLookAt(camera.position, camera.target, camera.up);
+    view.viewProjection = MatrixMul(view.view, view.projection);
+    view.lodHeight = (float)GetSceneRenderHeight();
+    view.fogCullDistance = -1.0f;
+    return view;
+}
+
+static int SelectLod(GameObject* obj, const RenderView* view, RenderStats* stats)
+{
+    Vector3 center;
+    float radius;
+    
+    GetObjectBounds(obj, &center, &radius);
+    int lod = UpdateObjectLod(obj, center, radius, view->camera, view->lodHeight);
+    
+    stats->lodObjects[lod]++;
+    return lod;
+}
+
+static unsigned int QuantizeDepth(Vector3 position, Vector3 eye)
+{
+    float dx = position.x - eye.x;
+    float dy = position.y - eye.y;
+    float dz = position.z - eye.z;
+    float depth = sqrtf(dx*dx + dy*dy + dz*dz) / RENDER_DEPTH_RANGE;
+
+    if (depth < 0.0f) depth = 0.0f;
+    if (depth > 1.0f) depth = 1.0f;
+    return (unsigned int)(depth * KEY_DEPTH_MAX);
+}
+
+static uint64_t MakeSortKey(int pass, bool transparent, int shader, unsigned int textureId,
+                            int mesh, unsigned int depth)
+{
+    uint64_t state = ((uint64_t)(shader & 0xF) << 24) |
+                     ((uint64_t)(textureId & 0xFFFF) << 8) |
+                     (uint64_t)(mesh & 0xFF);
+    uint64_t key = ((uint64_t)pass << KEY_PASS_SHIFT);
+
+    if (transparent)
+    {
+        // Back-to-front wins over state for blended geometry
+        key |= (uint64_t)1 << KEY_TRANSPARENT_SHIFT;
+        key |= (uint64_t)(KEY_DEPTH_MAX - depth) << 28;
+        key |= state;
+    }
+    else
+    {
+        key |= state << 28;
+        key |= depth;
+    }
+    return key;
+}
+
+// LSD radix sort, 8 bits per pass; passes where every key shares the
+// digit are skipped, which is most of the high bits in practice
+static void SortRenderQueue(RenderItem* queue, RenderItem* sortScratch, int count)
+{
+    if (count <= 1) return;
+
+    RenderItem* src = queue;
+    RenderItem* dst = sortScratch;
+
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        int histogram[256] = {0};
+        for (int i = 0; i < count; i++)
+        {
+            histogram[(src[i].key >> shift) & 0xFF]++;
+        }
+
+        if (histogram[(src[0].key >> shift) & 0xFF] == count) continue;
+
+        int offset = 0;
+        for (int d = 0; d < 256; d++)
+        {
+            int n = histogram[d];
+            histogram[d] = offset;
+            offset += n;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            dst[histogram[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+
+        RenderItem* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != queue)
+    {
+        for (int i = 0; i < count; i++) queue[i] = src[i];
+    }
+}
+
+static bool SameState(const RenderItem* a, const RenderItem* b)
+{
+    return a->shader == b->shader && a->textureId == b->textureId &&
+           a->primitive == b->primitive && a->lod == b->lod;
+}
+
+static void BuildRenderRuns(RenderFrame* frame)
+{
+    RenderItem* queue = frame->items;
+    int queued = frame->itemCount;
+
+    SortRenderQueue(queue, frame->sortScratch, queued);
+
+    frame->runCount = 0;
+    frame->stateChanges = 0;
+
+    // Consecutive items with the same state become one instanced draw
+    const RenderItem* previous = NULL;
+    int runStart = 0;
+    int written = 0;
+    for (int i = 0; queued > 0 && i <= queued; i++)
+    {
+        if (i < queued && (i == runStart || SameState(&queue[i], &queue[runStart]))) continue;
+
+        const RenderItem* run = &queue[runStart];
+        int count = i - runStart;
+
+        for (int k = 0; k < count; k++)
+        {
+            frame->instances[written + k] = frame->sources[run[k].object];
+        }
+
+        if (!previous || previous->shader != run->shader) frame->stateChanges++;
+        if (!previous || previous->textureId != run->textureId) frame->stateChanges++;
+        if (!previous || previous->primitive != run->primitive ||
+            previous->lod != run->lod) frame->stateChanges++;
+        previous = run;
+
+        RenderRun* out = &frame->runs[frame->runCount++];
+        out->shader = run->shader;
+        out->primitive = run->primitive;
+        out->lod = run->lod;
+        out->textureId = run->textureId;
+        out->firstInstance = written;
+        out->instanceCount = count;
+        written += count;
+
+        runStart = i;
+    }
+}
+
+static void QueueRenderItem(RenderFrame* frame, int shader, MeshPrimitive primitive, int lod,
+                            unsigned int textureId, const InstanceData* instance, Vector3 eye)
+{
+    RenderItem* item = &frame->items[frame->itemCount];
+    Vector3 position = { instance->transform[12], instance->transform[13], instance->transform[14] };
+
+    item->object = frame->itemCount;
+    item->shader = shader;
+    item->primitive = primitive;
+    item->lod = lod;
+    item->textureId = textureId;
+    item->key = MakeSortKey(RENDER_PASS_GEOMETRY, instance->color.a < 255, shader, textureId,
+                            primitive * MESH_LOD_COUNT + lod, QuantizeDepth(position, eye));
+
+    frame->sources[frame->itemCount++] = *instance;
+}
+
+static void RecordRenderRuns(RenderFrame* frame, RenderCommandList* list, RenderStats* stats)
+{
+    for (int r = 0; r < frame->runCount; r++)
+    {
+        const RenderRun* run = &frame->runs[r];
+        const Mesh* mesh = (run->shader == RENDER_SHADER_IMPOSTOR) ? GetImpostorMesh() :
+                           &GetCachedModelLod(run->primitive, run->lod)->meshes[0];
+
+        RecordInstancesCommand(list, RENDER_PASS_GEOMETRY, mesh, run->textureId,
+                               &frame->instances[run->firstInstance], run->instanceCount, 0);
+        stats->trianglesDrawn += mesh->triangleCount * run->instanceCount;
+
+        stats->instanceBatches++;
+        stats->instancesDrawn += run->instanceCount;
+        stats->drawCalls += IsInstancingSupported() ? 1 : run->instanceCount;
+    }
+
+    stats->stateChanges += frame->stateChanges;
+}
+
+// Every category compiles to nothing without QWEE_DEBUG_DRAW
+static void QueueDebugShapes(const PipelineFrame* frame)
+{
+    bool colliders = IsDebugDrawCategoryEnabled(DEBUG_DRAW_COLLIDERS);
+    bool bounds = IsDebugDrawCategoryEnabled(DEBUG_DRAW_BOUNDS);
+
+    for (int i = 0; (colliders || bounds) && i < frame->objectCount; i++)
+    {
+        const GameObject* obj = &frame->objects[i];
+        if (!frame->visible[i]) continue;
+
+        if (colliders && obj->hasCollision) DebugBox(obj->position, obj->size, BLACK);
+        if (bounds)
+        {
+            Vector3 center;
+            float radius;
+            GetObjectBounds(obj, &center, &radius);
+            DebugSphere(center, radius, 6, SKYBLUE);
+        }
+    }
+
+    if (IsDebugDrawCategoryEnabled(DEBUG_DRAW_CONTACTS))
+    {
+        int contactCount = 0;
+        PhysicsContact* contacts = GetPhysicsContacts(&contactCount);
+
+        for (int i = 0; i < contactCount; i++)
+        {
+            const ContactInfo* contact = &contacts[i].info;
+            float length = fmaxf(contact->depth, 0.25f);
+
+            DebugLine(contact->point, Vector3Add(contact->point, Vector3Scale(contact->normal, length)), RED);
+            DebugBox(contact->point, (Vector3){0.1f, 0.1f, 0.1f}, ORANGE);
+        }
+    }
+}
+
+void RecordRenderObjects(PipelineFrame* frame)
+{
+    GameObject** objects = frame->objectList;
+    int objectCount = frame->objectCount;
+    Vector3 eye = frame->view.camera.position;
+    RenderStats* stats = &frame->renderStats;
+    RenderCommandList* list = &frame->commands;
+    int firstCommand = list->commandCount;
+
+    *stats = (RenderStats){0};
+    UpdateCulling(&frame->view, objects, objectCount);
+
+    for (int i = 0; i < objectCount; i++)
+    {
+        GameObject* obj = objects[i];
+        frame->visible[i] = obj->isActive && obj->isVisible && obj->type != OBJ_PLAYER && IsObjectInView(i);
+    }
+
+    // Wireframe draws debug lines on the main thread; LODs still pick the segments
+    if (frame->wireframe)
+    {
+        for (int i = 0; i < objectCount; i++)
+        {
+            if (!frame->visible[i]) continue;
+
+            SelectLod(objects[i], &frame->view, stats);
+            stats->objectsSubmitted++;
+            stats->drawCallsUnbatched++;
+        }
+
+        frame->objectCommands = GetCommandRange(list, firstCommand);
+        return;
+    }
+
+    // Static cubes/planes go out as merged per-cell meshes
+    stats->drawCalls += RecordStaticBatches(list);
+
+    RenderFrame* queue = &renderFrame;
+    queue->itemCount = 0;
+
+    for (int i = 0; i < objectCount; i++)
+    {
+        if (!frame->visible[i]) continue;
+
+        if (IsObjectStaticBatched(i))
+        {
+            stats->objectsSubmitted++;
+            stats->drawCallsUnbatched += objects[i]->hasCollision ? 2 : 1;
+            continue;
+        }
+
+        Vector3 position, scale;
+        unsigned int textureId;
+        MeshPrimitive primitive = GetObjectPrimitive(objects[i], &position, &scale);
+        Color color = GetObjectDrawColor(objects[i], &textureId);
+
+        stats->objectsSubmitted++;
+        stats->drawCallsUnbatched += objects[i]->hasCollision ? 2 : 1;
+
+        // Distant opaque objects cross-fade to a baked quad; every
+        // impostor shares the atlas, so the opaque ones make one run
+        float fade = (IsInstancingSupported() && color.a == 255) ? GetImpostorFade(position, eye) : 0.0f;
+        InstanceData impostor;
+        if (fade > 0.0f && MakeImpostorInstance(primitive, textureId, position, scale, color, eye, &impostor))
+        {
+            impostor.color.a = (unsigned char)(255.0f * fminf(fade * 2.0f, 1.0f));
+            QueueRenderItem(queue, RENDER_SHADER_IMPOSTOR, MESH_CUBE, 0, GetImpostorAtlasTexture(), &impostor, eye);
+            stats->impostors++;
+
+            if (fade >= 1.0f) continue;
+            color.a = (unsigned char)(255.0f * fminf((1.0f - fade) * 2.0f, 1.0f));
+        }
+
+        int lod = (primitive == MESH_CUBE) ? 0 : SelectLod(objects[i], &frame->view, stats);
+        InstanceData instance = MakeInstance(position, scale, color);
+
+        // The snapshot already mapped atlased textures to their page
+        if (IsInstancingSupported())
+        {
+            textureId = frame->textureIds[i];
+            memcpy(instance.uvRect, frame->uvRects[i], sizeof(instance.uvRect));
+        }
+        if (color.a < 255) stats->transparentObjects++;
+
+        QueueRenderItem(queue, RENDER_SHADER_INSTANCED, primitive, lod, textureId, &instance, eye);
+    }
+
+    BuildRenderRuns(queue);
+    RecordRenderRuns(queue, list, stats);
+    frame->objectCommands = GetCommandRange(list, firstCommand);
+}
+
+void SubmitRenderObjects(const PipelineFrame* frame)
+{
+    renderStats = frame->renderStats;
+    BeginGpuPass(GPU_PASS_OBJECTS);
+
+    if (frame->wireframe)
+    {
+        for (int i = 0; i < frame->objectCount; i++)
+        {
+            if (frame->visible[i]) DrawObjectWireframe(&frame->objects[i]);
+        }
+
+        BeginGpuPass(GPU_PASS_GRID);
+        QueueDebugShapes(frame);
+        if (FlushDebugDraw()) renderStats.drawCalls++;
+        EndGpuPass(GPU_PASS_GRID);
+        return;
+    }
+
+    BindShadowMap();
+    BindLights(frame->lights, frame->lightCount);
+
+    SubmitCommandList(&frame->commands, frame->objectCommands);
+
+    // Collider outlines and whatever else was queued: one draw
+    BeginGpuPass(GPU_PASS_GRID);
+    QueueDebugShapes(frame);
+    if (FlushDebugDraw()) renderStats.drawCalls++;
+    EndGpuPass(GPU_PASS_GRID);
+
+    UnbindLights();
+    UnbindShadowMap();
+}
+
+RenderStats* GetRenderStats()
+{
+    return &renderStats;
+}
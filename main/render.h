@@ -0,0 +1,85 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Render Module
+//==================================================================
+
+#ifndef RENDER_H
+#define RENDER_H
+
+#include "raylib.h"
+#include "objects.h"
+#include "mesh_cache.h"
+
+#define RENDER_DEPTH_RANGE 1000.0f
+
+typedef enum
+{
+    RENDER_PASS_GEOMETRY,
+    RENDER_PASS_SHADOW_DEPTH,
+    RENDER_PASS_EFFECTS,        // decals, fog grid, particles
+    RENDER_PASS_OVERLAY
+} RenderPass;
+
+typedef enum
+{
+    RENDER_SHADER_INSTANCED,
+    RENDER_SHADER_IMPOSTOR      // instancing shader, impostor quad and atlas
+} RenderShader;
+
+typedef struct
+{
+    int objectsSubmitted;
+    int transparentObjects;
+    int drawCalls;
+    int drawCallsUnbatched;
+    int instanceBatches;
+    int instancesDrawn;
+    int stateChanges;
+    int trianglesDrawn;
+    int impostors;
+    int lodObjects[MESH_LOD_COUNT];
+} RenderStats;
+
+// The camera a frame is recorded with, and the matrices BeginMode3D
+// builds from it when the frame is submitted
+typedef struct
+{
+    Camera3D camera;
+    Matrix view;
+    Matrix projection;
+    Matrix viewProjection;
+    float aspect;
+    float lodHeight;            // scene pixels, for screen-size LOD
+    float fogCullDistance;      // < 0 when fog hides nothing
+} RenderView;
+
+// Defined in render_pipeline.h
+typedef struct PipelineFrame PipelineFrame;
+
+void InitRender();
+void CloseRender();
+
+RenderView MakeRenderView(Camera3D camera, int width, int height);
+
+// Render worker: culls the frame's objects against its own view, picks
+// LODs and impostors, sorts the visible ones by state and depth (opaque
+// front-to-back, transparent back-to-front) and records runs of identical
+// state as instanced commands, after the static batches
+void RecordRenderObjects(PipelineFrame* frame);
+
+// Main thread, inside BeginMode3D with the frame's camera: binds lights
+// and the shadow map and submits what RecordRenderObjects recorded. In
+// wireframe the frame's objects are drawn as debug lines instead.
+void SubmitRenderObjects(const PipelineFrame* frame);
+
+// Default-shader replacement with fog and shadow-map receiving, for
+// materials drawn through DrawMesh/DrawModel
+Shader GetRenderMeshShader();
+
+MeshPrimitive GetObjectPrimitive(const GameObject* obj, Vector3* position, Vector3* scale);
+Color GetObjectDrawColor(const GameObject* obj, unsigned int* textureId);
+RenderStats* GetRenderStats();
+
+#endif
@@ -0,0 +1,373 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Render Pipeline Implementation
+//==================================================================
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "render_pipeline.h"
+#include "engine.h"
+#include "instancing.h"
+#include "static_batch.h"
+#include "texture_atlas.h"
+#include "fog.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct
+{
+    Mesh* mesh;                 // NULL for a texture
+    Texture2D texture;
+    unsigned int frame;         // newest frame that may draw it
+} RetiredResource;
+
+static PipelineFrame frames[RENDER_PIPELINE_SLOTS];
+static bool frameShown[RENDER_PIPELINE_SLOTS];
+static int pendingSlots[RENDER_PIPELINE_SLOTS];     // recorded or recording, oldest first
+static int pendingCount = 0;
+static int shownSlot = -1;
+static PipelineFrame* recording = NULL;             // until FinishRenderPipeline
+static unsigned int frameNumber = 0;
+static int renderLatency = RENDER_DEFAULT_LATENCY;
+
+static RetiredResource retired[MAX_RETIRED_RESOURCES];
+static int retiredCount = 0;
+
+static RenderPipelineStats pipelineStats = { .latency = RENDER_DEFAULT_LATENCY };
+
+static pthread_t worker;
+static pthread_mutex_t jobLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobReady = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t jobDone = PTHREAD_COND_INITIALIZER;
+static PipelineFrame* job = NULL;
+static bool workerRunning = false;
+static bool workerFailed = false;
+static bool stopWorker = false;
+
+static double GetMonotonicTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Everything the frame draws, in the order the main thread submits it
+static void RecordFrame(PipelineFrame* frame)
+{
+    double start = GetMonotonicTime();
+
+    ClearCommandList(&frame->commands);
+    RecordRenderObjects(frame);
+    RecordShadows(frame);
+
+    int firstCommand = frame->commands.commandCount;
+    if (frame->particles)
+    {
+        RecordParticles(&frame->commands, frame->particleSprites, frame->particleCount, frame->view.camera);
+    }
+    frame->particleCommands = GetCommandRange(&frame->commands, firstCommand);
+
+    frame->cullingStats = *GetCullingStats();
+    frame->recordMs = (float)((GetMonotonicTime() - start) * 1000.0);
+}
+
+static void* RenderWorkerMain(void* arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&jobLock);
+    while (true)
+    {
+        while (!job && !stopWorker) pthread_cond_wait(&jobReady, &jobLock);
+        if (stopWorker) break;
+
+        PipelineFrame* frame = job;
+        pthread_mutex_unlock(&jobLock);
+        RecordFrame(frame);
+        pthread_mutex_lock(&jobLock);
+
+        job = NULL;
+        pthread_cond_signal(&jobDone);
+    }
+    pthread_mutex_unlock(&jobLock);
+
+    return NULL;
+}
+
+static void StartRenderWorker()
+{
+    stopWorker = false;
+    job = NULL;
+
+    if (pthread_create(&worker, NULL, RenderWorkerMain, NULL) != 0)
+    {
+        printf("Warning: Failed to start the render worker, recording inline\n");
+        workerFailed = true;
+        return;
+    }
+
+    workerRunning = true;
+    printf("Render worker started\n");
+}
+
+static void StopRenderWorker()
+{
+    if (!workerRunning) return;
+
+    pthread_mutex_lock(&jobLock);
+    stopWorker = true;
+    pthread_cond_signal(&jobReady);
+    pthread_mutex_unlock(&jobLock);
+
+    pthread_join(worker, NULL);
+    workerRunning = false;
+}
+
+static void ReleaseResource(RetiredResource* resource)
+{
+    if (resource->mesh)
+    {
+        UnloadMesh(*resource->mesh);
+        free(resource->mesh);
+    }
+    else
+    {
+        UnloadTexture(resource->texture);
+    }
+}
+
+static void ReleaseRetired()
+{
+    unsigned int oldest = frameNumber + 1;
+    for (int i = 0; i < pendingCount; i++)
+    {
+        if (frames[pendingSlots[i]].number < oldest) oldest = frames[pendingSlots[i]].number;
+    }
+    if (shownSlot >= 0 && frames[shownSlot].number < oldest) oldest = frames[shownSlot].number;
+
+    int kept = 0;
+    for (int i = 0; i < retiredCount; i++)
+    {
+        if (retired[i].frame < oldest) ReleaseResource(&retired[i]);
+        else retired[kept++] = retired[i];
+    }
+
+    retiredCount = kept;
+    pipelineStats.retiredResources = retiredCount;
+}
+
+static void Retire(RetiredResource resource)
+{
+    if (pendingCount == 0 && shownSlot < 0)
+    {
+        ReleaseResource(&resource);
+        return;
+    }
+
+    // Out of room: drop the frames that could still draw them
+    if (retiredCount == MAX_RETIRED_RESOURCES) FlushRenderPipeline();
+    if (retiredCount == MAX_RETIRED_RESOURCES)
+    {
+        ReleaseResource(&resource);
+        return;
+    }
+
+    resource.frame = frameNumber;
+    retired[retiredCount++] = resource;
+    pipelineStats.retiredResources = retiredCount;
+}
+
+void RetireMesh(Mesh* mesh)
+{
+    if (!mesh) return;
+    Retire((RetiredResource){ .mesh = mesh });
+}
+
+void RetireTexture(Texture2D texture)
+{
+    if (texture.id == 0) return;
+    Retire((RetiredResource){ .texture = texture });
+}
+
+static void SnapshotFrame(PipelineFrame* frame)
+{
+    GameObject** live = GetObjects();
+    int count = *GetObjectCount();
+    GameObject* player = *GetPlayerObject();
+
+    frame->number = ++frameNumber;
+    frame->wireframe = *GetWireframeMode();
+    frame->fog = fogEnabled && GetFogSettings()->enabled;
+    frame->shadows = shadowsEnabled;
+    frame->particles = particlesEnabled;
+
+    frame->view = MakeRenderView(*GetCamera(), GetScreenWidth(), GetScreenHeight());
+    // Wireframe draws debug lines, which are never fogged
+    frame->view.fogCullDistance = frame->wireframe ? -1.0f : GetFogCullDistance();
+
+    frame->objectCount = count;
+    frame->player = -1;
+    for (int i = 0; i < count; i++)
+    {
+        GameObject* copy = &frame->objects[i];
+        if (live[i]) *copy = *live[i];
+        else *copy = (GameObject){0};
+
+        frame->objectList[i] = copy;
+        frame->sources[i] = live[i];
+        if (live[i] && live[i] == player) frame->player = i;
+
+        // Remapping may upload an atlas page, so it can't wait for the worker
+        float* uvRect = frame->uvRects[i];
+        GetObjectDrawColor(copy, &frame->textureIds[i]);
+        uvRect[0] = 0.0f;
+        uvRect[1] = 0.0f;
+        uvRect[2] = 1.0f;
+        uvRect[3] = 1.0f;
+        if (IsInstancingSupported()) RemapAtlasTexture(&frame->textureIds[i], uvRect);
+    }
+
+    frame->particleCount = frame->particles ? GatherParticleSprites(frame->particleSprites, MAX_PARTICLE_SPRITES) : 0;
+    frame->lightCount = CopyLights(frame->lights);
+}
+
+static int FindFreeSlot()
+{
+    for (int slot = 0; slot < RENDER_PIPELINE_SLOTS; slot++)
+    {
+        bool used = false;
+        for (int i = 0; i < pendingCount; i++) used = used || pendingSlots[i] == slot;
+        if (!used) return slot;
+    }
+    return 0;
+}
+
+static int PopPending()
+{
+    int slot = pendingSlots[0];
+    pendingCount--;
+    memmove(pendingSlots, pendingSlots + 1, (size_t)pendingCount * sizeof(int));
+    return slot;
+}
+
+const PipelineFrame* AdvanceRenderPipeline()
+{
+    FinishRenderPipeline();
+    shownSlot = -1;
+
+    // GL work the recording can't do: batch rebuilds, blob and mesh uploads
+    UpdateStaticBatches();
+    PrepareShadows();
+    LoadMeshCache();
+
+    int slot = FindFreeSlot();
+    PipelineFrame* frame = &frames[slot];
+    SnapshotFrame(frame);
+    frameShown[slot] = false;
+    pendingSlots[pendingCount++] = slot;
+
+    // A cut in latency drops the oldest frames rather than showing them late
+    while (pendingCount > renderLatency + 1)
+    {
+        if (!frameShown[PopPending()]) pipelineStats.framesDropped++;
+    }
+
+    // While the pipeline fills, the oldest frame is shown again
+    int show = pendingSlots[0];
+    if (pendingCount > renderLatency) PopPending();
+    if (frameShown[show]) pipelineStats.framesRepeated++;
+    frameShown[show] = true;
+    shownSlot = show;
+
+    if (show != slot && !workerRunning && !workerFailed) StartRenderWorker();
+
+    recording = frame;
+    if (show != slot && workerRunning)
+    {
+        pthread_mutex_lock(&jobLock);
+        job = frame;
+        pthread_cond_signal(&jobReady);
+        pthread_mutex_unlock(&jobLock);
+    }
+    else
+    {
+        RecordFrame(frame);
+    }
+
+    ReleaseRetired();
+    pipelineStats.latency = renderLatency;
+    pipelineStats.threaded = workerRunning;
+    pipelineStats.pendingFrames = pendingCount;
+    return &frames[show];
+}
+
+void FinishRenderPipeline()
+{
+    if (!recording) return;
+
+    double start = GetMonotonicTime();
+    if (workerRunning)
+    {
+        pthread_mutex_lock(&jobLock);
+        while (job) pthread_cond_wait(&jobDone, &jobLock);
+        pthread_mutex_unlock(&jobLock);
+    }
+    pipelineStats.waitMs = (float)((GetMonotonicTime() - start) * 1000.0);
+
+    // LOD hysteresis carries over to the next snapshot through the live objects
+    for (int i = 0; i < recording->objectCount; i++)
+    {
+        if (recording->sources[i]) recording->sources[i]->lodLevel = recording->objects[i].lodLevel;
+    }
+
+    pipelineStats.recordMs = recording->recordMs;
+    pipelineStats.framesRecorded++;
+    recording = NULL;
+
+    // The worker's culling state went with the newest frame; report the shown one
+    if (shownSlot >= 0) *GetCullingStats() = frames[shownSlot].cullingStats;
+}
+
+void FlushRenderPipeline()
+{
+    FinishRenderPipeline();
+
+    while (pendingCount > 0)
+    {
+        if (!frameShown[PopPending()]) pipelineStats.framesDropped++;
+    }
+    shownSlot = -1;
+
+    ReleaseRetired();
+    pipelineStats.pendingFrames = 0;
+}
+
+void CloseRenderPipeline()
+{
+    FlushRenderPipeline();
+    StopRenderWorker();
+    workerFailed = false;
+    pipelineStats.threaded = false;
+}
+
+void SetRenderLatency(int frames)
+{
+    if (frames < 0) frames = 0;
+    if (frames > RENDER_MAX_LATENCY) frames = RENDER_MAX_LATENCY;
+
+    renderLatency = frames;
+    printf("Render latency: %d frame%s\n", frames, frames == 1 ? "" : "s");
+}
+
+int GetRenderLatency()
+{
+    return renderLatency;
+}
+
+RenderPipelineStats* GetRenderPipelineStats()
+{
+    return &pipelineStats;
+}
@@ -0,0 +1,103 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Render Pipeline Module
+//==================================================================
+
+#ifndef RENDER_PIPELINE_H
+#define RENDER_PIPELINE_H
+
+#include "raylib.h"
+#include "objects.h"
+#include "render.h"
+#include "command_list.h"
+#include "culling.h"
+#include "shadows.h"
+#include "particles.h"
+#include "lights.h"
+#include <stdbool.h>
+
+#define RENDER_MAX_LATENCY 2
+#define RENDER_DEFAULT_LATENCY 1
+#define RENDER_PIPELINE_SLOTS (RENDER_MAX_LATENCY + 1)
+#define MAX_RETIRED_RESOURCES 256
+
+// One 3D frame: a copy of the scene as UpdateEngine left it, taken on the
+// main thread, and the commands recorded from that copy. sources[] are
+// the live objects; recording compares them but never reads through them.
+struct PipelineFrame
+{
+    unsigned int number;
+    RenderView view;
+    bool wireframe;
+    bool fog;
+    bool shadows;
+    bool particles;
+
+    GameObject objects[MAX_OBJECTS];
+    GameObject* objectList[MAX_OBJECTS];    // &objects[i], for code walking GameObject**
+    GameObject* sources[MAX_OBJECTS];
+    unsigned int textureIds[MAX_OBJECTS];   // atlas page when atlased, for instanced draws
+    float uvRects[MAX_OBJECTS][4];
+    int objectCount;
+    int player;                             // index into objects, -1 without one
+
+    ParticleSprite particleSprites[MAX_PARTICLE_SPRITES];
+    int particleCount;
+    Light lights[MAX_LIGHTS];
+    int lightCount;
+
+    // Written by the recording
+    RenderCommandList commands;
+    RenderCommandRange objectCommands;
+    RenderCommandRange particleCommands;
+    ShadowFrame shadow;
+    bool visible[MAX_OBJECTS];
+    RenderStats renderStats;
+    CullingStats cullingStats;
+    float recordMs;
+};
+
+typedef struct
+{
+    int latency;
+    bool threaded;              // frames record on the render worker
+    int pendingFrames;
+    int framesRecorded;
+    int framesRepeated;         // shown again while the pipeline fills
+    int framesDropped;          // recorded but never shown
+    int retiredResources;       // waiting for the frames that may draw them
+    float recordMs;             // last frame's recording, on whichever thread ran it
+    float waitMs;               // main thread blocked in FinishRenderPipeline
+} RenderPipelineStats;
+
+// Copies the scene, starts recording the copy on the render worker and
+// returns the frame to submit now: the one GetRenderLatency() frames
+// older once the pipeline is full, so submitting it overlaps the
+// recording. Call once per 3D frame after UpdateEngine, outside any
+// render target. Until FinishRenderPipeline, the main thread may only
+// submit: culling, LOD, impostors, static batches and blob shadows belong
+// to the worker, and no object may be created or destroyed.
+const PipelineFrame* AdvanceRenderPipeline();
+void FinishRenderPipeline();
+
+// Drops every pending frame, e.g. while 3D rendering is paused, so stale
+// frames aren't shown when it resumes
+void FlushRenderPipeline();
+void CloseRenderPipeline();
+
+// 0 records and submits the same frame on the main thread; each frame of
+// latency lets the worker record one frame while an older one submits
+void SetRenderLatency(int frames);
+int GetRenderLatency();
+
+// For GL resources a pending frame may still draw: released once every
+// frame snapshotted before the call has been shown or dropped. Call
+// outside AdvanceRenderPipeline/FinishRenderPipeline.
+void RetireMesh(Mesh* mesh);                // heap mesh, unloaded and freed
+void RetireTexture(Texture2D texture);
+
+RenderPipelineStats* GetRenderPipelineStats();
+
+#endif
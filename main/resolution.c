@@ -0,0 +1,195 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Dynamic Resolution Implementation
+//==================================================================
+
+#include "resolution.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdio.h>
+
+static ResolutionSettings resolutionSettings = {
+    .enabled = true,
+    .targetFrameMs = 1000.0f / 60.0f,
+    .minScale = 0.5f,
+    .maxScale = 1.0f
+};
+static ResolutionStats resolutionStats = { .scale = 1.0f };
+
+static RenderTexture2D sceneTarget = {0};
+static bool sceneTargetLoaded = false;
+static bool scaledActive = false;
+
+static bool governorPrimed = false;
+static int framesOnTarget = 0;
+static int framesSinceChange = 0;
+static int upscaleDelay = RESOLUTION_UPSCALE_DELAY;
+static bool lastChangeUp = false;
+
+static void SetScale(float scale, bool up)
+{
+    float lo = resolutionSettings.minScale;
+    float hi = resolutionSettings.maxScale;
+
+    scale = roundf(scale / RESOLUTION_SCALE_STEP) * RESOLUTION_SCALE_STEP;
+    if (scale < lo) scale = lo;
+    if (scale > hi) scale = hi;
+    if (scale == resolutionStats.scale) return;
+
+    // Restart the average so only frames at the new scale move it
+    resolutionStats.scale = scale;
+    resolutionStats.frameMs = resolutionSettings.targetFrameMs;
+    resolutionStats.scaleChanges++;
+    framesOnTarget = 0;
+    framesSinceChange = 0;
+    lastChangeUp = up;
+}
+
+// Drops a step when the smoothed frame time runs 10% over target. Meeting
+// the target can't show headroom under vsync, so it probes up a step after
+// a while on target, waiting twice as long after each probe that fails.
+static void UpdateGovernor(float frameMs)
+{
+    float target = resolutionSettings.targetFrameMs;
+
+    if (frameMs <= 0.0f) return;
+    if (frameMs > target * 4.0f) frameMs = target * 4.0f;   // one hitch shouldn't collapse the scale
+
+    if (!governorPrimed)
+    {
+        resolutionStats.frameMs = frameMs;
+        governorPrimed = true;
+    }
+    resolutionStats.frameMs += (frameMs - resolutionStats.frameMs) * 0.1f;
+    framesSinceChange++;
+
+    if (lastChangeUp && framesSinceChange == RESOLUTION_UPSCALE_DELAY) upscaleDelay = RESOLUTION_UPSCALE_DELAY;
+
+    if (resolutionStats.frameMs > target * 1.1f)
+    {
+        framesOnTarget = 0;
+
+        // Let the average catch up with the last change first
+        if (framesSinceChange < 20 || resolutionStats.scale <= resolutionSettings.minScale) return;
+
+        if (lastChangeUp && framesSinceChange < RESOLUTION_UPSCALE_DELAY)
+        {
+            upscaleDelay *= 2;
+            if (upscaleDelay > RESOLUTION_MAX_UPSCALE_DELAY) upscaleDelay = RESOLUTION_MAX_UPSCALE_DELAY;
+        }
+        SetScale(resolutionStats.scale - RESOLUTION_SCALE_STEP, false);
+    }
+    else if (resolutionStats.frameMs <= target * 1.02f)
+    {
+        if (++framesOnTarget >= upscaleDelay && resolutionStats.scale < resolutionSettings.maxScale)
+        {
+            SetScale(resolutionStats.scale + RESOLUTION_SCALE_STEP, true);
+        }
+    }
+    else
+    {
+        framesOnTarget = 0;
+    }
+}
+
+// Sized to the window once; lower scales render into a corner of it
+static bool LoadSceneTarget(int width, int height)
+{
+    if (sceneTargetLoaded && sceneTarget.texture.width == width && sceneTarget.texture.height == height)
+    {
+        return true;
+    }
+
+    if (sceneTargetLoaded) UnloadRenderTexture(sceneTarget);
+
+    sceneTarget = LoadRenderTexture(width, height);
+    sceneTargetLoaded = IsRenderTextureReady(sceneTarget);
+    if (!sceneTargetLoaded)
+    {
+        printf("Warning: Failed to create dynamic resolution target, rendering at full size\n");
+        resolutionSettings.enabled = false;
+        return false;
+    }
+
+    SetTextureFilter(sceneTarget.texture, TEXTURE_FILTER_BILINEAR);
+    return true;
+}
+
+void BeginScaledRender()
+{
+    int screenWidth = GetScreenWidth();
+    int screenHeight = GetScreenHeight();
+
+    if (resolutionSettings.enabled) UpdateGovernor(GetFrameTime() * 1000.0f);
+
+    float scale = resolutionSettings.enabled ? resolutionStats.scale : 1.0f;
+    resolutionStats.history[resolutionStats.historyIndex] = scale;
+    resolutionStats.historyIndex = (resolutionStats.historyIndex + 1) % RESOLUTION_HISTORY;
+
+    resolutionStats.width = (int)(screenWidth * scale);
+    resolutionStats.height = (int)(screenHeight * scale);
+    if (resolutionStats.width < 1) resolutionStats.width = 1;
+    if (resolutionStats.height < 1) resolutionStats.height = 1;
+
+    scaledActive = scale < 1.0f && LoadSceneTarget(screenWidth, screenHeight);
+    if (!scaledActive) return;
+
+    // BeginMode3D takes its aspect from the target, which matches the window
+    BeginTextureMode(sceneTarget);
+    rlViewport(0, 0, resolutionStats.width, resolutionStats.height);
+}
+
+void EndScaledRender()
+{
+    if (!scaledActive) return;
+
+    EndTextureMode();
+
+    // Copy, don't blend: translucent draws leave alpha below 1 in the target
+    Rectangle source = { 0, 0, (float)resolutionStats.width, -(float)resolutionStats.height };
+    Rectangle dest = { 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() };
+
+    rlDrawRenderBatchActive();
+    rlDisableColorBlend();
+    DrawTexturePro(sceneTarget.texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+    rlDrawRenderBatchActive();
+    rlEnableColorBlend();
+
+    scaledActive = false;
+}
+
+void CloseDynamicResolution()
+{
+    if (sceneTargetLoaded) UnloadRenderTexture(sceneTarget);
+
+    sceneTarget = (RenderTexture2D){0};
+    sceneTargetLoaded = false;
+    scaledActive = false;
+}
+
+int GetSceneRenderHeight()
+{
+    if (!resolutionSettings.enabled) return GetScreenHeight();
+
+    int height = (int)(GetScreenHeight() * resolutionStats.scale);
+    return height > 0 ? height : 1;
+}
+
+void SetDynamicResolutionEnabled(bool enabled)
+{
+    resolutionSettings.enabled = enabled;
+    if (!enabled) resolutionStats.scale = resolutionSettings.maxScale;
+    printf("Dynamic resolution %s\n", enabled ? "enabled" : "disabled");
+}
+
+ResolutionSettings* GetResolutionSettings()
+{
+    return &resolutionSettings;
+}
+
+ResolutionStats* GetResolutionStats()
+{
+    return &resolutionStats;
+}
@@ -0,0 +1,54 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Dynamic Resolution Module
+//==================================================================
+
+#ifndef RESOLUTION_H
+#define RESOLUTION_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define RESOLUTION_HISTORY 120
+#define RESOLUTION_SCALE_STEP 0.05f
+#define RESOLUTION_UPSCALE_DELAY 60       // frames on target before probing up
+#define RESOLUTION_MAX_UPSCALE_DELAY 1200
+
+typedef struct
+{
+    bool enabled;
+    float targetFrameMs;
+    float minScale;
+    float maxScale;
+} ResolutionSettings;
+
+typedef struct
+{
+    float scale;
+    int width;
+    int height;
+    float frameMs;                  // smoothed
+    int scaleChanges;
+    float history[RESOLUTION_HISTORY];
+    int historyIndex;               // next write; oldest entry when full
+} ResolutionStats;
+
+// Wrap the 3D pass. BeginScaledRender feeds the last frame time to the
+// governor, then redirects drawing to an offscreen target at the current
+// scale; EndScaledRender upscales it to the window. At full scale both
+// draw straight to the window, keeping MSAA and skipping the copy.
+void BeginScaledRender();
+void EndScaledRender();
+void CloseDynamicResolution();
+
+// Height in pixels the 3D pass renders at under the current scale, for
+// anything that measures on-screen size
+int GetSceneRenderHeight();
+
+void SetDynamicResolutionEnabled(bool enabled);
+ResolutionSettings* GetResolutionSettings();
+ResolutionStats* GetResolutionStats();
+
+#endif
@@ -1155,45 +1155,47 @@ void DrawGameUI() {
     int screenWidth = GetScreenWidth();
     int screenHeight = GetScreenHeight();
 
-    DrawRectangle(0, 0, screenWidth, 80, (Color){0, 0, 0, 200});
+    BeginOverlay();
 
-    DrawText("HEALTH", 20, 10, 24, RED);
-    DrawRectangle(20, 40, 200, 20, (Color){50, 0, 0, 255});
+    OverlayRect("ui.topBar", 0, 0, screenWidth, 80, (Color){0, 0, 0, 200});
+
+    OverlayText("ui.healthLabel", "HEALTH", 20, 10, 24, RED);
+    OverlayRect("ui.healthBack", 20, 40, 200, 20, (Color){50, 0, 0, 255});
     float healthPercent = (float)playerHealth / playerMaxHealth;
-    DrawRectangle(20, 40, (int)(200 * healthPercent), 20, RED);
-    DrawText(TextFormat("%d/%d", playerHealth, playerMaxHealth), 230, 40, 20, WHITE);
+    OverlayRect("ui.healthBar", 20, 40, (int)(200 * healthPercent), 20, RED);
+    OverlayText("ui.health", TextFormat("%d/%d", playerHealth, playerMaxHealth), 230, 40, 20, WHITE);
 
-    DrawText("AMMO", 300, 10, 24, YELLOW);
-    DrawRectangle(300, 40, 150, 20, (Color){50, 50, 0, 255});
+    OverlayText("ui.ammoLabel", "AMMO", 300, 10, 24, YELLOW);
+    OverlayRect("ui.ammoBack", 300, 40, 150, 20, (Color){50, 50, 0, 255});
     float ammoPercent = (float)playerAmmo / playerMaxAmmo;
-    DrawRectangle(300, 40, (int)(150 * ammoPercent), 20, YELLOW);
-    DrawText(TextFormat("%d/%d", playerAmmo, playerMaxAmmo), 460, 40, 20, WHITE);
-    DrawText("[R]", 520, 40, 20, LIGHTGRAY);
+    OverlayRect("ui.ammoBar", 300, 40, (int)(150 * ammoPercent), 20, YELLOW);
+    OverlayText("ui.ammo", TextFormat("%d/%d", playerAmmo, playerMaxAmmo), 460, 40, 20, WHITE);
+    OverlayText("ui.reloadKey", "[R]", 520, 40, 20, LIGHTGRAY);
 
-    DrawText(TextFormat("WAVE: %d", currentWave), screenWidth/2 - 100, 10, 28, ORANGE);
-    DrawText(TextFormat("NEXT: %.0fs", nextWaveTime - waveTimer), screenWidth/2 - 100, 40, 20, LIGHTGRAY);
+    OverlayText("ui.wave", TextFormat("WAVE: %d", currentWave), screenWidth/2 - 100, 10, 28, ORANGE);
+    OverlayText("ui.nextWave", TextFormat("NEXT: %.0fs", nextWaveTime - waveTimer), screenWidth/2 - 100, 40, 20, LIGHTGRAY);
 
-    DrawText(TextFormat("SCORE: %d", score), screenWidth - 250, 10, 28, YELLOW);
+    OverlayText("ui.score", TextFormat("SCORE: %d", score), screenWidth - 250, 10, 28, YELLOW);
  
-    DrawText(TextFormat("KILLS: %d", kills), screenWidth - 250, 40, 20, WHITE);
+    OverlayText("ui.kills", TextFormat("KILLS: %d", kills), screenWidth - 250, 40, 20, WHITE);
 
     int enemiesLeft = 0;
     for (int i = 0; i < MAX_ENEMIES; i++) {
         if (enemies[i].active && !enemies[i].isDying) enemiesLeft++;
     }
-    DrawText(TextFormat("ENEMIES: %d", enemiesLeft), 
+    OverlayText("ui.enemies", TextFormat("ENEMIES: %d", enemiesLeft), 
             screenWidth - 120, 65, 18, enemiesLeft > 10 ? RED : WHITE);
  
     if (powerupTimer > 0) {
         int boostY = 90;
         if (powerupSpeedBoost > 1.0f) {
-            DrawRectangle(20, boostY, 180, 25, (Color){0, 100, 0, 150});
-            DrawText(TextFormat("SPEED BOOST: %.1f", powerupTimer), 25, boostY + 3, 20, GREEN);
+            OverlayRect("ui.speedBack", 20, boostY, 180, 25, (Color){0, 100, 0, 150});
+            OverlayText("ui.speed", TextFormat("SPEED BOOST: %.1f", powerupTimer), 25, boostY + 3, 20, GREEN);
             boostY += 30;
         }
         if (powerupDamageBoost > 1.0f) {
-            DrawRectangle(20, boostY, 180, 25, (Color){100, 0, 0, 150});
-            DrawText(TextFormat("DAMAGE BOOST: %.1f", powerupTimer), 25, boostY + 3, 20, RED);
+            OverlayRect("ui.damageBack", 20, boostY, 180, 25, (Color){100, 0, 0, 150});
+            OverlayText("ui.damage", TextFormat("DAMAGE BOOST: %.1f", powerupTimer), 25, boostY + 3, 20, RED);
         }
     }
 
@@ -1203,32 +1205,35 @@ void DrawGameUI() {
         int textWidth = MeasureText(waveText, textSize);
         
         float pulse = sinf(gameTime * 10) * 0.5f + 0.5f;
-        DrawText(waveText, screenWidth/2 - textWidth/2, screenHeight/2 - 100, textSize, 
+        OverlayText("ui.waveComplete", waveText, screenWidth/2 - textWidth/2, screenHeight/2 - 100, textSize, 
                 (Color){255, (unsigned char)(255 * pulse), (unsigned char)(100 * pulse), 255});
         
-        DrawText("PREPARE FOR NEXT WAVE!", screenWidth/2 - 150, screenHeight/2 - 40, 24, YELLOW);
+        OverlayText("ui.prepare", "PREPARE FOR NEXT WAVE!", screenWidth/2 - 150, screenHeight/2 - 40, 24, YELLOW);
     }
  
-    DrawRectangle(0, screenHeight - 50, screenWidth, 50, (Color){0, 0, 0, 200});
+    OverlayRect("ui.bottomBar", 0, screenHeight - 50, screenWidth, 50, (Color){0, 0, 0, 200});
 
     const char* controls = "WASD:Move | MOUSE:Aim | LMB:Shoot | SPACE:Jump | SHIFT:Run | R:Reload | P:Pause | H:Heal(Cheat)";
-    DrawText(controls, 10, screenHeight - 40, 18, LIGHTGRAY);
+    OverlayText("ui.controls", controls, 10, screenHeight - 40, 18, LIGHTGRAY);
 
-    DrawText(TextFormat("TIME: %.1f", gameTime), screenWidth - 150, screenHeight - 40, 20, WHITE);
+    OverlayText("ui.time", TextFormat("TIME: %.1f", gameTime), screenWidth - 150, screenHeight - 40, 20, WHITE);
 
     if (playerHealth < 30) {
         float blink = sinf(gameTime * 10) * 0.5f + 0.5f;
-        DrawText("LOW HEALTH!", screenWidth/2 - 80, screenHeight/2 + 100, 30, 
+        OverlayText("ui.lowHealth", "LOW HEALTH!", screenWidth/2 - 80, screenHeight/2 + 100, 30, 
                 (Color){255, (unsigned char)(50 * blink), (unsigned char)(50 * blink), 255});
     }
 
     if (playerAmmo < 5) {
         float blink = sinf(gameTime * 8) * 0.5f + 0.5f;
-        DrawText("LOW AMMO!", screenWidth/2 - 70, screenHeight/2 + 140, 30, 
+        OverlayText("ui.lowAmmo", "LOW AMMO!", screenWidth/2 - 70, screenHeight/2 + 140, 30, 
                 (Color){255, 255, (unsigned char)(50 * blink), 255});
     }
 
-    DrawFPS(screenWidth - 100, 90);
+    OverlayFPS("ui.fps", screenWidth - 100, 90);
+    OverlayFPS("ui.fpsCorner", 10, 10);
+
+    DrawOverlay();
 }
 
 int main(void) {
@@ -1291,6 +1296,9 @@ int main(void) {
     printf("  - Progressive enemy difficulty\n");
     printf("  - Ammo packs\n");
     
+    // Draw3DGame reads the live game state, so the objects can't lag it
+    SetRenderLatency(0);
+    
     while (!WindowShouldClose()) {
         float dt = GetDeltaTime();
         if (dt > 0.1f) dt = 0.1f;
@@ -1305,6 +1313,10 @@ int main(void) {
         
         BeginDrawing();
         
+        if (gameState != STATE_PLAYING) {
+            FlushRenderPipeline();
+        }
+        
         switch (gameState) {
             case STATE_INTRO:
 
@@ -1330,26 +1342,33 @@ int main(void) {
                 }
                 break;
                 
-            case STATE_PLAYING:
-                ClearBackground((Color){30, 30, 50, 255});
+            case STATE_PLAYING: {
+                const PipelineFrame* frame = AdvanceRenderPipeline();
                 
-                BeginMode3D(*GetCamera());
+                if (frame->shadows) {
+                    BeginGpuPass(GPU_PASS_SHADOWS);
+                    SubmitShadowPass(frame);
+                    EndGpuPass(GPU_PASS_SHADOWS);
+                }
                 
-                GameObject** objects = GetObjects();
-                int* objectCount = GetObjectCount();
+                BeginScaledRender();
+                ClearBackground((Color){30, 30, 50, 255});
                 
-                for (int i = 0; i < *objectCount; i++) {
-                    if (objects[i] && objects[i]->isActive) {
-                        DrawObject(objects[i]);
-                    }
-                }
+                BeginMode3D(frame->view.camera);
+                
+                ApplyFog();
+                SubmitRenderObjects(frame);
                 
                 Draw3DGame();
                 
                 EndMode3D();
+                EndScaledRender();
+                FinishRenderPipeline();
                 
+                BeginGpuPass(GPU_PASS_OVERLAY);
                 DrawGameUI();
                 break;
+            }
                 
             case STATE_PAUSED:
                 ClearBackground((Color){30, 30, 50, 255});
@@ -1368,10 +1387,13 @@ int main(void) {
                 break;
         }
         
-        if (gameState != STATE_INTRO) {
+        // The playing HUD draws its own counter as part of the overlay
+        if (gameState != STATE_INTRO && gameState != STATE_PLAYING) {
             DrawFPS(10, 10);
         }
         
+        // UpdateEngine opened the timer frame; RenderAll isn't used here
+        EndGpuTimerFrame();
         EndDrawing();
     }
     
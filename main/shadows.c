@@ -6,14 +6,25 @@
 //==================================================================
 
 #include "shadows.h"
+#include "render_pipeline.h"
 #include "engine.h"
 #include "objects.h"
+#include "instancing.h"
+#include "command_list.h"
+#include "rlgl.h"
 #include <stdio.h>
 #include <math.h>
 
+#define BLOB_TEXTURE_SIZE 64
+
+// raylib's PixelFormat has no depth entries; this is the value its own
+// LoadRenderTexture stores for a 24-bit depth attachment
+#define SHADOW_DEPTH_FORMAT_24BIT 19
+
 static ShadowSettings shadowSettings = {
     .enabled = true,
     .type = SHADOW_SIMPLE,
+    .technique = SHADOW_TECHNIQUE_MAP,
     .shadowColor = {0, 0, 0, 100},
     .intensity = 0.7f,
     .softness = 2.0f,
@@ -23,12 +34,133 @@ static ShadowSettings shadowSettings = {
     .receiveShadows = true
 };
 
+typedef enum
+{
+    SHADOW_UNIFORM_ENABLED,
+    SHADOW_UNIFORM_MAP,
+    SHADOW_UNIFORM_LIGHT_VP,
+    SHADOW_UNIFORM_LIGHT_DIR,
+    SHADOW_UNIFORM_TYPE,
+    SHADOW_UNIFORM_TEXEL,
+    SHADOW_UNIFORM_SOFTNESS,
+    SHADOW_UNIFORM_STRENGTH,
+    SHADOW_UNIFORM_COLOR,
+    SHADOW_UNIFORM_COUNT
+} ShadowUniform;
+
+static const char* shadowUniformNames[SHADOW_UNIFORM_COUNT] = {
+    "shadowMapEnabled", "shadowMap", "lightVP", "lightDir", "shadowType",
+    "shadowTexel", "shadowSoftness", "shadowStrength", "shadowColor"
+};
+
+typedef struct
+{
+    Shader shader;
+    int locs[SHADOW_UNIFORM_COUNT];
+} ShadowShader;
+
 static RenderTexture2D shadowMap = {0};
 static int shadowMapSize = 1024;
+static bool shadowMapReady = false;
+static Matrix lightViewProjection = {0};
+static ShadowPassKey shadowPass = {0};     // what the map holds
+static ShadowStats shadowStats = {0};
+
+static ShadowShader shadowShaders[MAX_SHADOW_SHADERS];
+static int shadowShaderCount = 0;
+static bool uniformsDirty = true;
+static bool uploadedActive = false;       // last full upload
+static ShadowSettings uploadedSettings;
+static bool enabledUploaded = false;      // "enabled" flips on unbind alone
+
+// Cached per object slot for the blob technique; the object is the live
+// one, kept only to notice when the slot holds a different object
+typedef struct
+{
+    const GameObject* object;
+    Vector3 position;
+    Vector3 size;
+    bool casts;
+    Vector3 center;
+    float radius;
+} BlobShadow;
+
+static BlobShadow blobShadows[MAX_OBJECTS];
+static InstanceData blobInstances[MAX_OBJECTS];
+static Vector3 blobLightDir = {0};
+static Mesh blobQuad = {0};
+static Texture2D blobTextures[2] = {0};
+static bool blobResourcesLoaded = false;
+
+static InstanceData casterInstances[MAX_OBJECTS];
+static int casterGroup[MAX_OBJECTS];
+
+static Texture2D GenBlobTexture(float density)
+{
+    Image image = GenImageGradientRadial(BLOB_TEXTURE_SIZE, BLOB_TEXTURE_SIZE, density,
+                                         WHITE, (Color){255, 255, 255, 0});
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    return texture;
+}
+
+static void LoadBlobResources()
+{
+    blobQuad = GenMeshPlane(1.0f, 1.0f, 1, 1);
+    blobTextures[0] = GenBlobTexture(0.9f);   // hard disc
+    blobTextures[1] = GenBlobTexture(0.2f);   // radial falloff
+    blobResourcesLoaded = true;
+}
+
+static void UnloadBlobResources()
+{
+    if (!blobResourcesLoaded) return;
+
+    UnloadMesh(blobQuad);
+    UnloadTexture(blobTextures[0]);
+    UnloadTexture(blobTextures[1]);
+    blobResourcesLoaded = false;
+}
+
+// Depth-only target: the depth attachment is a texture we can sample
+static bool LoadShadowMapTarget(int size)
+{
+    if (rlGetVersion() < RL_OPENGL_33) return false;
+
+    shadowMap = (RenderTexture2D){0};
+    shadowMap.id = rlLoadFramebuffer(size, size);
+    if (shadowMap.id == 0) return false;
+
+    shadowMap.texture.width = size;
+    shadowMap.texture.height = size;
+
+    rlEnableFramebuffer(shadowMap.id);
+    shadowMap.depth.id = rlLoadTextureDepth(size, size, false);
+    shadowMap.depth.width = size;
+    shadowMap.depth.height = size;
+    shadowMap.depth.mipmaps = 1;
+    shadowMap.depth.format = SHADOW_DEPTH_FORMAT_24BIT;
+    rlFramebufferAttach(shadowMap.id, shadowMap.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_TEXTURE2D, 0);
+
+    bool complete = rlFramebufferComplete(shadowMap.id);
+    rlDisableFramebuffer();
+
+    if (!complete)
+    {
+        rlUnloadFramebuffer(shadowMap.id);
+        shadowMap = (RenderTexture2D){0};
+    }
+    return complete;
+}
 
 void InitShadows(int screenWidth, int screenHeight)
 {
-    shadowMap = LoadRenderTexture(shadowMapSize, shadowMapSize);
+    shadowMapReady = LoadShadowMapTarget(shadowMapSize);
+    if (!shadowMapReady)
+    {
+        printf("Shadow map unavailable, using blob shadows\n");
+        shadowSettings.technique = SHADOW_TECHNIQUE_BLOB;
+    }
 
     float length = sqrtf(shadowSettings.lightDirection.x * shadowSettings.lightDirection.x +
                         shadowSettings.lightDirection.y * shadowSettings.lightDirection.y +
@@ -46,88 +178,464 @@ void InitShadows(int screenWidth, int screenHeight)
 
 void CloseShadows()
 {
+    // The depth texture goes with the framebuffer
     UnloadRenderTexture(shadowMap);
+    UnloadBlobResources();
+    shadowMap = (RenderTexture2D){0};
+    shadowMapReady = false;
+    shadowPass.valid = false;
     printf("Shadow system closed\n");
 }
 
-void UpdateShadows()
+static bool IsShadowMapActive()
 {
-    //update
+    return shadowMapReady && shadowSettings.enabled && shadowSettings.shadowsEnabled &&
+           shadowSettings.technique == SHADOW_TECHNIQUE_MAP && shadowPass.valid;
 }
 
-void RenderShadows()
+static Vector3 GetLightDirection()
 {
-    if (!shadowSettings.enabled || !shadowSettings.shadowsEnabled) return;
-    
-    GameObject** objects = GetObjects();
-    int* objectCount = GetObjectCount();
-    Camera3D* camera = GetCamera();
-
     Vector3 lightDir = shadowSettings.lightDirection;
-    float lightDirLength = sqrtf(lightDir.x*lightDir.x + lightDir.y*lightDir.y + lightDir.z*lightDir.z);
-    if (lightDirLength > 0)
+    if (Vector3Length(lightDir) <= 0.0f) lightDir = (Vector3){0, -1, 0};
+    return Vector3Normalize(lightDir);
+}
+
+static void GetLightBasis(Vector3 lightDir, Vector3* right, Vector3* up)
+{
+    Vector3 worldUp = (fabsf(lightDir.y) > 0.99f) ? (Vector3){0, 0, 1} : (Vector3){0, 1, 0};
+    *right = Vector3Normalize(Vector3CrossProduct(lightDir, worldUp));
+    *up = Vector3CrossProduct(*right, lightDir);
+}
+
+// Bounding sphere of the view frustum out to maxDistance. A sphere keeps
+// its size as the camera turns, and its center is snapped to whole shadow
+// texels so a still or slowly moving camera keeps the same light frustum.
+static void FitLightFrustum(const Camera3D* camera, float aspect, Vector3 lightDir, Vector3* center, float* radius)
+{
+    float depth = shadowSettings.maxDistance;
+    float halfHeight = depth * tanf(camera->fovy * 0.5f * DEG2RAD);
+    float halfWidth = halfHeight * aspect;
+
+    Vector3 forward = Vector3Normalize(Vector3Subtract(camera->target, camera->position));
+    *center = Vector3Add(camera->position, Vector3Scale(forward, depth * 0.5f));
+    *radius = sqrtf(depth * depth * 0.25f + halfHeight * halfHeight + halfWidth * halfWidth);
+
+    Vector3 right, up;
+    GetLightBasis(lightDir, &right, &up);
+
+    float texel = (*radius * 2.0f) / shadowMapSize;
+    float u = floorf(Vector3DotProduct(*center, right) / texel) * texel;
+    float v = floorf(Vector3DotProduct(*center, up) / texel) * texel;
+    float w = floorf(Vector3DotProduct(*center, lightDir) / texel) * texel;
+
+    *center = Vector3Add(Vector3Add(Vector3Scale(right, u), Vector3Scale(up, v)), Vector3Scale(lightDir, w));
+}
+
+static bool IsShadowCaster(GameObject* obj)
+{
+    return obj && obj->isActive && obj->isVisible && obj->type != OBJ_PLAYER;
+}
+
+static bool InLightFrustum(Vector3 point, float pointRadius, Vector3 center, float radius, Vector3 lightDir)
+{
+    Vector3 right, up;
+    GetLightBasis(lightDir, &right, &up);
+
+    Vector3 offset = Vector3Subtract(point, center);
+    float reach = radius + pointRadius;
+
+    return fabsf(Vector3DotProduct(offset, right)) <= reach &&
+           fabsf(Vector3DotProduct(offset, up)) <= reach &&
+           Vector3DotProduct(offset, lightDir) >= -(reach + SHADOW_CASTER_MARGIN);
+}
+
+// Cubes have a single level, so their LOD never changes the depth pass
+static int GetCasterLod(GameObject* obj, MeshPrimitive primitive)
+{
+    int lod = (primitive == MESH_CUBE) ? 0 : obj->lodLevel;
+    return (lod < 0 || lod >= MESH_LOD_COUNT) ? 0 : lod;
+}
+
+// Hashed with the live object's address, which a frame's copy doesn't share
+static unsigned int HashCaster(const GameObject* source, GameObject* obj)
+{
+    Vector3 position, scale;
+    MeshPrimitive primitive = GetObjectPrimitive(obj, &position, &scale);
+
+    // The LOD level picks the caster mesh, so a switch must redraw the map
+    const float values[8] = {
+        obj->position.x, obj->position.y, obj->position.z,
+        obj->size.x, obj->size.y, obj->size.z, (float)obj->type, (float)GetCasterLod(obj, primitive)
+    };
+    const unsigned char* bytes = (const unsigned char*)values;
+    unsigned int hash = 2166136261u;
+
+    for (size_t i = 0; i < sizeof(source); i++) hash = (hash ^ ((const unsigned char*)&source)[i]) * 16777619u;
+    for (size_t i = 0; i < sizeof(values); i++) hash = (hash ^ bytes[i]) * 16777619u;
+    return hash;
+}
+
+// Casters grouped by mesh and LOD, one instanced command per group
+static void RecordDepthPass(PipelineFrame* frame)
+{
+    GameObject** objects = frame->objectList;
+    int objectCount = frame->objectCount;
+    ShadowFrame* shadow = &frame->shadow;
+    ShadowPassKey* key = &shadow->key;
+    int groupCount[MESH_PRIMITIVE_COUNT * MESH_LOD_COUNT] = {0};
+    int groupStart[MESH_PRIMITIVE_COUNT * MESH_LOD_COUNT];
+
+    key->valid = true;
+    key->lightDir = GetLightDirection();
+    FitLightFrustum(&frame->view.camera, frame->view.aspect, key->lightDir, &key->center, &key->radius);
+
+    // Order-independent, so only real movement invalidates the pass
+    for (int i = 0; i < objectCount; i++)
+    {
+        casterGroup[i] = -1;
+        if (!IsShadowCaster(objects[i])) continue;
+
+        Vector3 center, position, scale;
+        float radius;
+        GetObjectBounds(objects[i], &center, &radius);
+        if (!InLightFrustum(center, radius, key->center, key->radius, key->lightDir)) continue;
+
+        key->casterSignature += HashCaster(frame->sources[i], objects[i]);
+        key->casterCount++;
+
+        MeshPrimitive primitive = GetObjectPrimitive(objects[i], &position, &scale);
+        casterGroup[i] = primitive * MESH_LOD_COUNT + GetCasterLod(objects[i], primitive);
+        groupCount[casterGroup[i]]++;
+    }
+
+    int offset = 0;
+    for (int g = 0; g < MESH_PRIMITIVE_COUNT * MESH_LOD_COUNT; g++)
     {
-        lightDir.x /= lightDirLength;
-        lightDir.y /= lightDirLength;
-        lightDir.z /= lightDirLength;
+        groupStart[g] = offset;
+        offset += groupCount[g];
     }
-    
-    for (int i = 0; i < *objectCount; i++)
+
+    for (int i = 0; i < objectCount; i++)
+    {
+        if (casterGroup[i] < 0) continue;
+
+        Vector3 position, scale;
+        GetObjectPrimitive(objects[i], &position, &scale);
+        casterInstances[groupStart[casterGroup[i]]++] = MakeInstance(position, scale, WHITE);
+    }
+
+    Vector3 eye = Vector3Subtract(key->center, Vector3Scale(key->lightDir, key->radius + SHADOW_CASTER_MARGIN));
+    Vector3 right, up;
+    GetLightBasis(key->lightDir, &right, &up);
+
+    shadow->lightCamera = (Camera3D){0};
+    shadow->lightCamera.position = eye;
+    shadow->lightCamera.target = key->center;
+    shadow->lightCamera.up = up;
+    shadow->lightCamera.fovy = key->radius * 2.0f;
+    shadow->lightCamera.projection = CAMERA_ORTHOGRAPHIC;
+
+    int firstCommand = frame->commands.commandCount;
+    for (int g = 0; g < MESH_PRIMITIVE_COUNT * MESH_LOD_COUNT; g++)
+    {
+        if (groupCount[g] == 0) continue;
+
+        Model* model = GetCachedModelLod((MeshPrimitive)(g / MESH_LOD_COUNT), g % MESH_LOD_COUNT);
+        RecordInstancesCommand(&frame->commands, RENDER_PASS_SHADOW_DEPTH, &model->meshes[0], 0,
+                               &casterInstances[groupStart[g] - groupCount[g]], groupCount[g], 0);
+    }
+
+    shadow->depthCommands = GetCommandRange(&frame->commands, firstCommand);
+    shadow->casters = key->casterCount;
+}
+
+static bool SamePass(const ShadowPassKey* a, const ShadowPassKey* b)
+{
+    return a->valid && b->valid &&
+           a->casterSignature == b->casterSignature && a->casterCount == b->casterCount &&
+           a->radius == b->radius &&
+           a->center.x == b->center.x && a->center.y == b->center.y && a->center.z == b->center.z &&
+           a->lightDir.x == b->lightDir.x && a->lightDir.y == b->lightDir.y && a->lightDir.z == b->lightDir.z;
+}
+
+void SubmitShadowPass(const PipelineFrame* frame)
+{
+    const ShadowFrame* shadow = &frame->shadow;
+
+    shadowStats.depthPassRendered = false;
+    if (!shadow->key.valid || !shadowMapReady) return;
+
+    if (SamePass(&shadowPass, &shadow->key))
+    {
+        shadowStats.cachedFrames++;
+        return;
+    }
+
+    BeginTextureMode(shadowMap);
+    rlClearScreenBuffers();
+    BeginMode3D(shadow->lightCamera);
+
+    lightViewProjection = MatrixMul(rlGetMatrixModelview(), rlGetMatrixProjection());
+    SubmitCommandList(&frame->commands, shadow->depthCommands);
+
+    EndMode3D();
+    EndTextureMode();
+
+    shadowPass = shadow->key;
+    shadowStats.casters = shadow->casters;
+    shadowStats.drawCalls = shadow->depthCommands.count;
+    shadowStats.depthPasses++;
+    shadowStats.depthPassRendered = true;
+    uniformsDirty = true;
+}
+
+bool RegisterShadowShader(Shader shader)
+{
+    if (shader.id == 0 || shader.id == rlGetShaderIdDefault()) return false;
+
+    for (int i = 0; i < shadowShaderCount; i++)
+    {
+        if (shadowShaders[i].shader.id == shader.id) return true;
+    }
+
+    if (shadowShaderCount >= MAX_SHADOW_SHADERS)
+    {
+        printf("Warning: Too many shadow shaders, shader %u won't receive shadows\n", shader.id);
+        return false;
+    }
+
+    ShadowShader* shadowShader = &shadowShaders[shadowShaderCount++];
+    shadowShader->shader = shader;
+    for (int u = 0; u < SHADOW_UNIFORM_COUNT; u++)
+    {
+        shadowShader->locs[u] = GetShaderLocation(shader, shadowUniformNames[u]);
+    }
+
+    int slot = SHADOW_MAP_TEXTURE_SLOT;
+    SetShaderValue(shader, shadowShader->locs[SHADOW_UNIFORM_MAP], &slot, SHADER_UNIFORM_INT);
+
+    uniformsDirty = true;
+    return true;
+}
+
+void UnregisterShadowShader(Shader shader)
+{
+    for (int i = 0; i < shadowShaderCount; i++)
+    {
+        if (shadowShaders[i].shader.id != shader.id) continue;
+
+        shadowShaders[i] = shadowShaders[--shadowShaderCount];
+        return;
+    }
+}
+
+static bool ShadowUniformsChanged(const ShadowSettings* a, const ShadowSettings* b)
+{
+    return a->type != b->type || a->intensity != b->intensity || a->softness != b->softness ||
+           a->shadowColor.r != b->shadowColor.r || a->shadowColor.g != b->shadowColor.g ||
+           a->shadowColor.b != b->shadowColor.b || a->shadowColor.a != b->shadowColor.a;
+}
+
+static void SetShadowsEnabledUniform(bool active)
+{
+    int enabled = active ? 1 : 0;
+    for (int i = 0; i < shadowShaderCount; i++)
+    {
+        SetShaderValue(shadowShaders[i].shader, shadowShaders[i].locs[SHADOW_UNIFORM_ENABLED], &enabled, SHADER_UNIFORM_INT);
+    }
+    enabledUploaded = active;
+}
+
+void BindShadowMap()
+{
+    bool active = IsShadowMapActive();
+
+    if (active != uploadedActive || ShadowUniformsChanged(&uploadedSettings, &shadowSettings))
+    {
+        uniformsDirty = true;
+    }
+
+    if (uniformsDirty)
+    {
+        int enabled = active ? 1 : 0;
+        int type = (int)shadowSettings.type;
+        float texel = 1.0f / shadowMapSize;
+        float strength = shadowSettings.intensity * shadowSettings.shadowColor.a / 255.0f;
+        float color[4] = { shadowSettings.shadowColor.r/255.0f, shadowSettings.shadowColor.g/255.0f,
+                           shadowSettings.shadowColor.b/255.0f, 1.0f };
+        float lightDir[3] = { shadowPass.lightDir.x, shadowPass.lightDir.y, shadowPass.lightDir.z };
+
+        for (int i = 0; i < shadowShaderCount; i++)
+        {
+            ShadowShader* shadowShader = &shadowShaders[i];
+            Shader shader = shadowShader->shader;
+
+            SetShaderValue(shader, shadowShader->locs[SHADOW_UNIFORM_ENABLED], &enabled, SHADER_UNIFORM_INT);
+            if (!active) continue;
+
+            SetShaderValueMatrix(shader, shadowShader->locs[SHADOW_UNIFORM_LIGHT_VP], lightViewProjection);
+            SetShaderValue(shader, shadowShader->locs[SHADOW_UNIFORM_LIGHT_DIR], lightDir, SHADER_UNIFORM_VEC3);
+            SetShaderValue(shader, shadowShader->locs[SHADOW_UNIFORM_TYPE], &type, SHADER_UNIFORM_INT);
+            SetShaderValue(shader, shadowShader->locs[SHADOW_UNIFORM_TEXEL], &texel, SHADER_UNIFORM_FLOAT);
+            SetShaderValue(shader, shadowShader->locs[SHADOW_UNIFORM_SOFTNESS], &shadowSettings.softness, SHADER_UNIFORM_FLOAT);
+            SetShaderValue(shader, shadowShader->locs[SHADOW_UNIFORM_STRENGTH], &strength, SHADER_UNIFORM_FLOAT);
+            SetShaderValue(shader, shadowShader->locs[SHADOW_UNIFORM_COLOR], color, SHADER_UNIFORM_VEC4);
+        }
+
+        uploadedActive = active;
+        uploadedSettings = shadowSettings;
+        enabledUploaded = active;
+        uniformsDirty = false;
+    }
+    else if (active != enabledUploaded)
+    {
+        SetShadowsEnabledUniform(active);
+    }
+
+    shadowStats.mapActive = active;
+    if (!active) return;
+
+    rlActiveTextureSlot(SHADOW_MAP_TEXTURE_SLOT);
+    rlEnableTexture(shadowMap.depth.id);
+    rlActiveTextureSlot(0);
+}
+
+void UnbindShadowMap()
+{
+    if (!shadowStats.mapActive) return;
+
+    // Unbound before the next depth pass renders into it
+    rlActiveTextureSlot(SHADOW_MAP_TEXTURE_SLOT);
+    rlDisableTexture();
+    rlActiveTextureSlot(0);
+
+    // Draws after the object pass (particles) must not sample the empty slot
+    SetShadowsEnabledUniform(false);
+}
+
+// Ground position and size of an object's blob; only redone when the
+// object or the light moves
+static void UpdateBlobShadow(BlobShadow* blob, const GameObject* source, GameObject* obj, Vector3 lightDir,
+                             ShadowFrame* shadow)
+{
+    blob->object = source;
+    blob->position = obj->position;
+    blob->size = obj->size;
+
+    float groundY = 0.0f;
+    float heightAboveGround = obj->position.y - (obj->size.y / 2) - groundY;
+
+    blob->casts = heightAboveGround > 0.01f;
+    if (!blob->casts) return;
+
+    float lightFactor = -lightDir.y;
+    if (lightFactor < 0.01f) lightFactor = 0.01f;
+
+    float shadowScale = 1.0f + (heightAboveGround * 0.1f);
+    float shadowSize = obj->size.x * shadowScale;
+
+    blob->center = obj->position;
+    blob->center.x += lightDir.x * (heightAboveGround / lightFactor) * 0.5f;
+    blob->center.y = groundY + 0.01f; // Slightly above ground
+    blob->center.z += lightDir.z * (heightAboveGround / lightFactor) * 0.5f;
+    blob->radius = shadowSize * 0.5f;
+    shadow->blobsRebuilt++;
+}
+
+static bool BlobMatches(const BlobShadow* blob, const GameObject* source, GameObject* obj)
+{
+    return blob->object == source &&
+           blob->position.x == obj->position.x && blob->position.y == obj->position.y &&
+           blob->position.z == obj->position.z && blob->size.x == obj->size.x &&
+           blob->size.y == obj->size.y && blob->size.z == obj->size.z;
+}
+
+static void RecordBlobShadows(PipelineFrame* frame)
+{
+    GameObject** objects = frame->objectList;
+    int objectCount = frame->objectCount;
+    ShadowFrame* shadow = &frame->shadow;
+    Vector3 eye = frame->view.camera.position;
+    Vector3 lightDir = GetLightDirection();
+    bool lightMoved = lightDir.x != blobLightDir.x || lightDir.y != blobLightDir.y ||
+                      lightDir.z != blobLightDir.z;
+
+    // Soft blobs cover the old outermost soft layer, 1.4x the base disc
+    bool soft = shadowSettings.type != SHADOW_SIMPLE;
+    float spread = soft ? 1.4f : 1.0f;
+    float maxDistanceSq = shadowSettings.maxDistance * shadowSettings.maxDistance;
+    Color shadowCol = shadowSettings.shadowColor;
+    float baseAlpha = shadowCol.a * shadowSettings.intensity;
+    int count = 0;
+
+    blobLightDir = lightDir;
+
+    for (int i = 0; i < objectCount; i++)
     {
         GameObject* obj = objects[i];
         if (!obj || !obj->isActive || !obj->isVisible || 
             obj->type == OBJ_PLANE || obj->type == OBJ_PLAYER)
             continue;
 
-        float dx = obj->position.x - camera->position.x;
-        float dy = obj->position.y - camera->position.y;
-        float dz = obj->position.z - camera->position.z;
-        float distance = sqrtf(dx*dx + dy*dy + dz*dz);
-        
-        if (distance > shadowSettings.maxDistance) continue;
-
-        float groundY = 0.0f; 
-        float heightAboveGround = obj->position.y - (obj->size.y / 2) - groundY;
-        
-        if (heightAboveGround <= 0.01f) continue; 
-        
-        float lightFactor = -lightDir.y;
-        if (lightFactor < 0.01f) lightFactor = 0.01f;
-        
-        float shadowScale = 1.0f + (heightAboveGround * 0.1f); 
-        
-        Vector3 shadowPos = obj->position;
-        shadowPos.x += lightDir.x * (heightAboveGround / lightFactor) * 0.5f;
-        shadowPos.y = groundY + 0.01f; // Slightly above ground
-        shadowPos.z += lightDir.z * (heightAboveGround / lightFactor) * 0.5f;
-
-        float distanceFactor = 1.0f - (distance / shadowSettings.maxDistance);
-        if (distanceFactor < 0) distanceFactor = 0;
-        
-        Color shadowCol = shadowSettings.shadowColor;
-        shadowCol.a = (unsigned char)(shadowCol.a * shadowSettings.intensity * distanceFactor);
-
-        float shadowSize = obj->size.x * shadowScale;
-        
-        if (shadowSettings.type == SHADOW_SIMPLE)
+        BlobShadow* blob = &blobShadows[i];
+        if (lightMoved || !BlobMatches(blob, frame->sources[i], obj))
         {
-            DrawCylinder(shadowPos, shadowSize * 0.5f, shadowSize * 0.5f, 0.02f, 16, shadowCol);
-        }
-        else if (shadowSettings.type == SHADOW_SOFT)
-        {
-            for (int layer = 0; layer < 3; layer++)
-            {
-                float layerScale = 1.0f + (layer * 0.2f);
-                Color layerCol = shadowCol;
-                layerCol.a = (unsigned char)(shadowCol.a * (0.7f - layer * 0.2f));
-                
-                DrawCylinder(shadowPos, 
-                           shadowSize * 0.5f * layerScale, 
-                           shadowSize * 0.5f * layerScale, 
-                           0.02f, 16, layerCol);
-            }
+            UpdateBlobShadow(blob, frame->sources[i], obj, lightDir, shadow);
         }
+        if (!blob->casts) continue;
+
+        Vector3 offset = Vector3Subtract(obj->position, eye);
+        float distanceSq = Vector3DotProduct(offset, offset);
+        if (distanceSq > maxDistanceSq) continue;
+
+        float radius = blob->radius * spread;
+        if (!IsSphereInView(blob->center, radius, CULL_SHADOWS)) continue;
+
+        float distanceFactor = 1.0f - sqrtf(distanceSq) / shadowSettings.maxDistance;
+        shadowCol.a = (unsigned char)(baseAlpha * distanceFactor);
+
+        blobInstances[count++] = MakeInstance(blob->center, (Vector3){radius * 2.0f, 1.0f, radius * 2.0f}, shadowCol);
     }
+
+    // Translucent decals: don't let them occlude each other or later passes
+    int firstCommand = frame->commands.commandCount;
+    RecordInstancesCommand(&frame->commands, RENDER_PASS_EFFECTS, &blobQuad, blobTextures[soft ? 1 : 0].id,
+                           blobInstances, count, RENDER_STATE_NO_DEPTH_WRITE);
+    shadow->blobCommands = GetCommandRange(&frame->commands, firstCommand);
+    shadow->blobsDrawn = count;
+}
+
+void PrepareShadows()
+{
+    bool blobs = shadowSettings.technique != SHADOW_TECHNIQUE_MAP || !shadowMapReady;
+    if (blobs && !blobResourcesLoaded) LoadBlobResources();
+}
+
+void RecordShadows(PipelineFrame* frame)
+{
+    frame->shadow = (ShadowFrame){0};
+    if (!frame->shadows || !shadowSettings.enabled || !shadowSettings.shadowsEnabled) return;
+
+    // Depth-map shadows are applied while the receivers draw
+    if (shadowSettings.technique == SHADOW_TECHNIQUE_MAP && shadowMapReady)
+    {
+        RecordDepthPass(frame);
+    }
+    else if (blobResourcesLoaded)
+    {
+        RecordBlobShadows(frame);
+    }
+}
+
+void SubmitBlobShadows(const PipelineFrame* frame)
+{
+    const ShadowFrame* shadow = &frame->shadow;
+    if (shadow->key.valid) return;
+
+    shadowStats.blobsRebuilt = shadow->blobsRebuilt;
+    shadowStats.blobsDrawn = shadow->blobsDrawn;
+    shadowStats.drawCalls = shadow->blobCommands.count;
+    SubmitCommandList(&frame->commands, shadow->blobCommands);
 }
 
 void SetShadowsEnabled(bool enabled)
@@ -142,6 +650,19 @@ void SetShadowType(ShadowType type)
     printf("Shadow type set to: %d\n", type);
 }
 
+void SetShadowTechnique(ShadowTechnique technique)
+{
+    if (technique == SHADOW_TECHNIQUE_MAP && !shadowMapReady)
+    {
+        printf("Warning: Shadow map unavailable, keeping blob shadows\n");
+        return;
+    }
+
+    shadowSettings.technique = technique;
+    shadowPass.valid = false;
+    printf("Shadow technique set to: %s\n", technique == SHADOW_TECHNIQUE_MAP ? "shadow map" : "blob");
+}
+
 void SetShadowIntensity(float intensity)
 {
     shadowSettings.intensity = intensity;
@@ -233,4 +754,9 @@ ShadowSettings* GetShadowSettings()
 RenderTexture2D GetShadowMap()
 {
     return shadowMap;
+}
+
+ShadowStats* GetShadowStats()
+{
+    return &shadowStats;
 }
\ No newline at end of file
@@ -10,8 +10,56 @@
 
 #include "raylib.h"
 #include "objects.h"
+#include "command_list.h"
 #include <stdbool.h>
 
+#define SHADOW_MAP_TEXTURE_SLOT 7
+#define MAX_SHADOW_SHADERS 8
+#define SHADOW_CASTER_MARGIN 40.0f   // casters this far toward the light still count
+
+// GLSL 330 shadow-map uniforms and ShadowAmount(worldPosition, worldNormal),
+// 0 = lit, shadowStrength = fully shadowed. Shaders that use it are kept up
+// to date after RegisterShadowShader.
+#define SHADOW_SHADER_GLSL \
+    "uniform int shadowMapEnabled;\n" \
+    "uniform sampler2D shadowMap;\n" \
+    "uniform mat4 lightVP;\n" \
+    "uniform vec3 lightDir;\n" \
+    "uniform int shadowType;\n" \
+    "uniform float shadowTexel;\n" \
+    "uniform float shadowSoftness;\n" \
+    "uniform float shadowStrength;\n" \
+    "uniform vec4 shadowColor;\n" \
+    "float ShadowTap(vec3 coord, vec2 offset)\n" \
+    "{\n" \
+    "    return (coord.z > texture(shadowMap, coord.xy + offset*shadowTexel).r) ? 1.0 : 0.0;\n" \
+    "}\n" \
+    "float ShadowAmount(vec3 position, vec3 normal)\n" \
+    "{\n" \
+    "    if (shadowMapEnabled == 0) return 0.0;\n" \
+    "    float ndotl = dot(normalize(normal), -lightDir);\n" \
+    "    if (ndotl <= 0.0) return shadowStrength;\n" \
+    "    vec4 clip = lightVP*vec4(position, 1.0);\n" \
+    "    vec3 coord = clip.xyz/clip.w*0.5 + 0.5;\n" \
+    "    if (any(lessThan(coord, vec3(0.0))) || any(greaterThan(coord, vec3(1.0)))) return 0.0;\n" \
+    "    coord.z -= max(0.002*(1.0 - ndotl), 0.0005);\n" \
+    "    float shadow = 0.0;\n" \
+    "    if (shadowType == 0) shadow = ShadowTap(coord, vec2(0.0));\n" \
+    "    else if (shadowType == 1)\n" \
+    "    {\n" \
+    "        float r = max(shadowSoftness*0.5, 0.5);\n" \
+    "        shadow = 0.25*(ShadowTap(coord, vec2(-r, -r)) + ShadowTap(coord, vec2(r, -r)) +\n" \
+    "                       ShadowTap(coord, vec2(-r, r)) + ShadowTap(coord, vec2(r, r)));\n" \
+    "    }\n" \
+    "    else\n" \
+    "    {\n" \
+    "        for (int y = -1; y <= 1; y++)\n" \
+    "            for (int x = -1; x <= 1; x++) shadow += ShadowTap(coord, vec2(x, y));\n" \
+    "        shadow /= 9.0;\n" \
+    "    }\n" \
+    "    return shadow*shadowStrength;\n" \
+    "}\n"
+
 typedef enum
 {
     SHADOW_SIMPLE,
@@ -20,10 +68,17 @@ typedef enum
     SHADOW_VOLUMETRIC
 } ShadowType;
 
+typedef enum
+{
+    SHADOW_TECHNIQUE_MAP,      // depth map sampled by the geometry shaders
+    SHADOW_TECHNIQUE_BLOB      // cached ground blobs in one instanced draw
+} ShadowTechnique;
+
 typedef struct
 {
     bool enabled;
     ShadowType type;
+    ShadowTechnique technique;
     Color shadowColor;
     float intensity;
     float softness;
@@ -33,13 +88,70 @@ typedef struct
     bool receiveShadows;
 } ShadowSettings;
 
+typedef struct
+{
+    bool mapActive;
+    bool depthPassRendered;    // this frame
+    int depthPasses;
+    int cachedFrames;          // frames that reused the previous depth pass
+    int casters;
+    int drawCalls;
+    int blobsDrawn;
+    int blobsRebuilt;          // this frame
+} ShadowStats;
+
+// What a depth pass is rendered with; an unchanged key reuses the map
+typedef struct
+{
+    bool valid;
+    Vector3 center;
+    float radius;
+    Vector3 lightDir;
+    unsigned int casterSignature;
+    int casterCount;
+} ShadowPassKey;
+
+// A recorded frame's shadows: the depth pass it wants (key.valid is false
+// when the map is off) and its blob decals, both in the frame's list
+typedef struct
+{
+    ShadowPassKey key;
+    Camera3D lightCamera;
+    RenderCommandRange depthCommands;
+    RenderCommandRange blobCommands;
+    int casters;
+    int blobsDrawn;
+    int blobsRebuilt;
+} ShadowFrame;
+
 void InitShadows(int screenWidth, int screenHeight);
 void CloseShadows();
-void UpdateShadows();
-void RenderShadows();
+
+// Main thread, before a frame records: loads the blob quad and textures
+// the first time blob shadows are used
+void PrepareShadows();
+
+// Render worker: fits the light frustum to the frame's view and records
+// the casters, or the visible blobs, into the frame's list
+void RecordShadows(PipelineFrame* frame);
+
+// Main thread, outside any render target: renders the frame's depth pass
+// unless the map already holds the same casters from the same light
+void SubmitShadowPass(const PipelineFrame* frame);
+
+// Main thread, inside BeginMode3D with the frame's camera
+void SubmitBlobShadows(const PipelineFrame* frame);
+
+// Around the main geometry pass: binds the depth map and refreshes the
+// uniforms of every registered shader when the map or settings changed
+void BindShadowMap();
+void UnbindShadowMap();
+bool RegisterShadowShader(Shader shader);
+void UnregisterShadowShader(Shader shader);
 
 void SetShadowsEnabled(bool enabled);
 void SetShadowType(ShadowType type);
+void SetShadowTechnique(ShadowTechnique technique);
 void SetShadowIntensity(float intensity);
 void SetShadowSoftness(float softness);
 void SetShadowDistance(float distance);
@@ -56,5 +168,6 @@ void SetDramaticShadows();
 
 ShadowSettings* GetShadowSettings();
 RenderTexture2D GetShadowMap();
+ShadowStats* GetShadowStats();
 
 #endif
\ No newline at end of file
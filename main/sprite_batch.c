@@ -0,0 +1,368 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Sprite Batch Implementation
+//==================================================================
+
+#include "sprite_batch.h"
+#include "command_list.h"
+#include "vector_math.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct
+{
+    unsigned int textureId;
+    float u0, v0, u1, v1;
+    float x, y, width, height;
+    float originX, originY;
+    float rotation;
+    Color tint;
+} QueuedSprite;
+
+static QueuedSprite spriteQueue[MAX_SPRITES];
+static int spriteCount = 0;
+
+// layer (16) | texture (16) | submission index (32)
+static uint64_t sortKeys[MAX_SPRITES];
+static uint64_t sortScratch[MAX_SPRITES];
+
+static Mesh spriteBuffers[SPRITE_BUFFERS];
+static int bufferCursor = 0;
+static bool buffersReady = false;
+static bool buffersFailed = false;
+
+static SpriteBatchStats spriteStats = {0};
+
+void SubmitSprite(const Sprite* sprite)
+{
+    if (spriteCount >= MAX_SPRITES)
+    {
+        spriteStats.dropped++;
+        return;
+    }
+
+    QueuedSprite* queued = &spriteQueue[spriteCount];
+    float textureWidth = sprite->texture.width > 0 ? (float)sprite->texture.width : 1.0f;
+    float textureHeight = sprite->texture.height > 0 ? (float)sprite->texture.height : 1.0f;
+
+    queued->textureId = sprite->texture.id ? sprite->texture.id : rlGetTextureIdDefault();
+    queued->u0 = sprite->source.x / textureWidth;
+    queued->v0 = sprite->source.y / textureHeight;
+    queued->u1 = (sprite->source.x + sprite->source.width) / textureWidth;
+    queued->v1 = (sprite->source.y + sprite->source.height) / textureHeight;
+    queued->x = sprite->position.x;
+    queued->y = sprite->position.y;
+    queued->width = sprite->size.x;
+    queued->height = sprite->size.y;
+    queued->originX = sprite->origin.x;
+    queued->originY = sprite->origin.y;
+    queued->rotation = sprite->rotation;
+    queued->tint = sprite->tint;
+
+    int layer = sprite->layer;
+    if (layer < SPRITE_LAYER_MIN) layer = SPRITE_LAYER_MIN;
+    if (layer > SPRITE_LAYER_MAX) layer = SPRITE_LAYER_MAX;
+
+    sortKeys[spriteCount] = ((uint64_t)(layer - SPRITE_LAYER_MIN) << 48) |
+                            ((uint64_t)(queued->textureId & 0xFFFF) << 32) |
+                            (uint64_t)spriteCount;
+    spriteCount++;
+}
+
+void DrawSprite(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin,
+                float rotation, Color tint, int layer)
+{
+    Sprite sprite = {
+        texture, source,
+        { dest.x, dest.y },
+        { dest.width, dest.height },
+        origin, rotation, tint, layer
+    };
+    SubmitSprite(&sprite);
+}
+
+// Keys arrive in submission order, so sorting the upper 32 bits with a
+// stable LSD radix keeps that order within each layer and texture
+static void SortSpriteKeys(int count)
+{
+    uint64_t* src = sortKeys;
+    uint64_t* dst = sortScratch;
+
+    for (int shift = 32; shift < 64; shift += 8)
+    {
+        int histogram[256] = {0};
+        for (int i = 0; i < count; i++)
+        {
+            histogram[(src[i] >> shift) & 0xFF]++;
+        }
+
+        if (histogram[(src[0] >> shift) & 0xFF] == count) continue;
+
+        int offset = 0;
+        for (int d = 0; d < 256; d++)
+        {
+            int n = histogram[d];
+            histogram[d] = offset;
+            offset += n;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            dst[histogram[(src[i] >> shift) & 0xFF]++] = src[i];
+        }
+
+        uint64_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != sortKeys)
+    {
+        for (int i = 0; i < count; i++) sortKeys[i] = src[i];
+    }
+}
+
+// Top-left, bottom-left, bottom-right, top-right, as DrawTexturePro emits them
+static void GetSpriteCorners(const QueuedSprite* sprite, float* corners)
+{
+    float left = -sprite->originX;
+    float top = -sprite->originY;
+    float right = left + sprite->width;
+    float bottom = top + sprite->height;
+    float local[4][2] = { {left, top}, {left, bottom}, {right, bottom}, {right, top} };
+
+    if (sprite->rotation == 0.0f)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            corners[c * 2] = sprite->x + local[c][0];
+            corners[c * 2 + 1] = sprite->y + local[c][1];
+        }
+        return;
+    }
+
+    float s = sinf(sprite->rotation * DEG2RAD);
+    float k = cosf(sprite->rotation * DEG2RAD);
+    for (int c = 0; c < 4; c++)
+    {
+        corners[c * 2] = sprite->x + local[c][0] * k - local[c][1] * s;
+        corners[c * 2 + 1] = sprite->y + local[c][0] * s + local[c][1] * k;
+    }
+}
+
+static bool LoadSpriteBuffers()
+{
+    for (int b = 0; b < SPRITE_BUFFERS; b++)
+    {
+        Mesh mesh = {0};
+        mesh.vertexCount = SPRITE_BUFFER_QUADS * 4;
+        mesh.triangleCount = SPRITE_BUFFER_QUADS * 2;
+        mesh.vertices = (float*)calloc(mesh.vertexCount * 3, sizeof(float));
+        mesh.texcoords = (float*)calloc(mesh.vertexCount * 2, sizeof(float));
+        mesh.colors = (unsigned char*)calloc(mesh.vertexCount * 4, sizeof(unsigned char));
+        mesh.indices = (unsigned short*)calloc(mesh.triangleCount * 3, sizeof(unsigned short));
+
+        if (!mesh.vertices || !mesh.texcoords || !mesh.colors || !mesh.indices)
+        {
+            printf("Warning: Out of memory creating sprite buffers\n");
+            free(mesh.vertices);
+            free(mesh.texcoords);
+            free(mesh.colors);
+            free(mesh.indices);
+            for (int i = 0; i < b; i++) UnloadMesh(spriteBuffers[i]);
+            return false;
+        }
+
+        for (int q = 0; q < SPRITE_BUFFER_QUADS; q++)
+        {
+            unsigned short* index = &mesh.indices[q * 6];
+            unsigned short base = (unsigned short)(q * 4);
+            index[0] = base;
+            index[1] = (unsigned short)(base + 1);
+            index[2] = (unsigned short)(base + 2);
+            index[3] = base;
+            index[4] = (unsigned short)(base + 2);
+            index[5] = (unsigned short)(base + 3);
+        }
+
+        UploadMesh(&mesh, true);
+        spriteBuffers[b] = mesh;
+    }
+
+    return true;
+}
+
+// Fresh storage for every fill orphans the old one, so a buffer the GPU
+// may still be reading from an earlier flush is never written in place
+static unsigned int ReplaceVertexBuffer(unsigned int vbo, const void* data, int size, int location,
+                                        int components, int type, bool normalized)
+{
+    rlUnloadVertexBuffer(vbo);
+    unsigned int replacement = rlLoadVertexBuffer(data, size, true);
+    rlSetVertexAttribute(location, components, type, normalized, 0, 0);
+    return replacement;
+}
+
+static int FillSpriteBuffer(Mesh* mesh, int first, int count)
+{
+    for (int q = 0; q < count; q++)
+    {
+        const QueuedSprite* sprite = &spriteQueue[(uint32_t)sortKeys[first + q]];
+        float corners[8];
+        float uv[4][2] = { {sprite->u0, sprite->v0}, {sprite->u0, sprite->v1},
+                           {sprite->u1, sprite->v1}, {sprite->u1, sprite->v0} };
+
+        GetSpriteCorners(sprite, corners);
+
+        for (int c = 0; c < 4; c++)
+        {
+            int v = q * 4 + c;
+            mesh->vertices[v*3 + 0] = corners[c * 2];
+            mesh->vertices[v*3 + 1] = corners[c * 2 + 1];
+            mesh->vertices[v*3 + 2] = 0.0f;
+            mesh->texcoords[v*2 + 0] = uv[c][0];
+            mesh->texcoords[v*2 + 1] = uv[c][1];
+            mesh->colors[v*4 + 0] = sprite->tint.r;
+            mesh->colors[v*4 + 1] = sprite->tint.g;
+            mesh->colors[v*4 + 2] = sprite->tint.b;
+            mesh->colors[v*4 + 3] = sprite->tint.a;
+        }
+    }
+
+    // Attribute pointers are recorded in the bound vertex array
+    int vertices = count * 4;
+    rlEnableVertexArray(mesh->vaoId);
+    mesh->vboId[0] = ReplaceVertexBuffer(mesh->vboId[0], mesh->vertices, vertices * 3 * sizeof(float),
+                                         RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, false);
+    mesh->vboId[1] = ReplaceVertexBuffer(mesh->vboId[1], mesh->texcoords, vertices * 2 * sizeof(float),
+                                         RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, false);
+    mesh->vboId[3] = ReplaceVertexBuffer(mesh->vboId[3], mesh->colors, vertices * 4 * sizeof(unsigned char),
+                                         RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, true);
+    spriteStats.uploads++;
+    return count;
+}
+
+// No buffers to stream into, so raylib draws them. On GL 1.1 rlBegin and
+// rlEnd are glBegin and glEnd, one draw per sprite; otherwise its batch
+// draws once per texture run and whenever its vertex buffer fills
+static void DrawSpritesImmediate(int count)
+{
+    bool immediate = (rlGetVersion() == RL_OPENGL_11);
+    unsigned int lastTexture = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const QueuedSprite* sprite = &spriteQueue[(uint32_t)sortKeys[i]];
+        float corners[8];
+
+        if (immediate || sprite->textureId != lastTexture) spriteStats.drawCalls++;
+        lastTexture = sprite->textureId;
+
+        GetSpriteCorners(sprite, corners);
+        rlCheckRenderBatchLimit(4);
+        rlSetTexture(sprite->textureId);
+        rlBegin(RL_QUADS);
+        rlColor4ub(sprite->tint.r, sprite->tint.g, sprite->tint.b, sprite->tint.a);
+        rlTexCoord2f(sprite->u0, sprite->v0);
+        rlVertex2f(corners[0], corners[1]);
+        rlTexCoord2f(sprite->u0, sprite->v1);
+        rlVertex2f(corners[2], corners[3]);
+        rlTexCoord2f(sprite->u1, sprite->v1);
+        rlVertex2f(corners[4], corners[5]);
+        rlTexCoord2f(sprite->u1, sprite->v0);
+        rlVertex2f(corners[6], corners[7]);
+        rlEnd();
+    }
+    rlSetTexture(0);
+    if (!immediate) spriteStats.drawCalls += count / RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+}
+
+bool FlushSprites()
+{
+    int count = spriteCount;
+
+    spriteStats.sprites = count;
+    spriteStats.drawCalls = 0;
+    spriteStats.uploads = 0;
+    spriteCount = 0;
+    if (count == 0 || GetRenderBackend() == RENDER_BACKEND_NULL) return false;
+
+    SortSpriteKeys(count);
+
+    if (!buffersReady && !buffersFailed && rlGetVersion() != RL_OPENGL_11)
+    {
+        buffersReady = LoadSpriteBuffers();
+        buffersFailed = !buffersReady;
+    }
+
+    if (!buffersReady)
+    {
+        DrawSpritesImmediate(count);
+        spriteStats.flushes++;
+        return true;
+    }
+
+    // Immediate-mode drawing queued so far ends up underneath the sprites
+    rlDrawRenderBatchActive();
+
+    int* locs = rlGetShaderLocsDefault();
+    float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    Matrix mvp = MatrixMul(rlGetMatrixModelview(), rlGetMatrixProjection());
+
+    rlEnableShader(rlGetShaderIdDefault());
+    rlSetUniformMatrix(locs[SHADER_LOC_MATRIX_MVP], mvp);
+    rlSetUniform(locs[SHADER_LOC_COLOR_DIFFUSE], white, RL_SHADER_UNIFORM_VEC4, 1);
+    rlActiveTextureSlot(0);
+    rlDisableBackfaceCulling();
+
+    for (int first = 0; first < count; first += SPRITE_BUFFER_QUADS)
+    {
+        Mesh* mesh = &spriteBuffers[bufferCursor];
+        int quads = FillSpriteBuffer(mesh, first, (count - first < SPRITE_BUFFER_QUADS) ? count - first : SPRITE_BUFFER_QUADS);
+        bufferCursor = (bufferCursor + 1) % SPRITE_BUFFERS;
+
+        // One draw per run of a texture within this buffer
+        int runStart = 0;
+        for (int q = 1; q <= quads; q++)
+        {
+            unsigned int textureId = spriteQueue[(uint32_t)sortKeys[first + runStart]].textureId;
+            if (q < quads && spriteQueue[(uint32_t)sortKeys[first + q]].textureId == textureId) continue;
+
+            rlEnableTexture(textureId);
+            rlDrawVertexArrayElements(runStart * 6, (q - runStart) * 6, 0);
+            spriteStats.drawCalls++;
+            runStart = q;
+        }
+    }
+
+    rlDisableVertexArray();
+    rlDisableTexture();
+    rlDisableShader();
+    rlEnableBackfaceCulling();
+
+    spriteStats.flushes++;
+    return true;
+}
+
+void CloseSpriteBatch()
+{
+    if (buffersReady)
+    {
+        for (int b = 0; b < SPRITE_BUFFERS; b++) UnloadMesh(spriteBuffers[b]);
+    }
+
+    buffersReady = false;
+    buffersFailed = false;
+    bufferCursor = 0;
+    spriteCount = 0;
+}
+
+SpriteBatchStats* GetSpriteBatchStats()
+{
+    return &spriteStats;
+}
@@ -0,0 +1,54 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Sprite Batch Module
+//==================================================================
+
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define MAX_SPRITES 65536                // per flush, extras are dropped
+#define SPRITE_BUFFER_QUADS 16384        // 16-bit indices cap one buffer
+#define SPRITE_BUFFERS (MAX_SPRITES / SPRITE_BUFFER_QUADS)
+#define SPRITE_LAYER_MIN -32768
+#define SPRITE_LAYER_MAX 32767
+
+typedef struct
+{
+    Texture2D texture;              // id 0 draws a tinted rectangle
+    Rectangle source;               // texels; a negative width or height flips
+    Vector2 position;
+    Vector2 size;                   // destination size in pixels
+    Vector2 origin;                 // pivot in destination pixels, as in DrawTexturePro
+    float rotation;                 // degrees, clockwise as in DrawTexturePro
+    Color tint;
+    int layer;                      // lower layers draw first
+} Sprite;
+
+typedef struct
+{
+    int sprites;                    // in the last flush
+    int dropped;
+    int drawCalls;
+    int uploads;
+    int flushes;
+} SpriteBatchStats;
+
+// Sprites queue on the CPU and go out at FlushSprites, sorted by layer
+// and then texture (submission order within a texture), streamed through
+// a few large vertex buffers and drawn in one call per texture run. The
+// engine flushes after RenderCurrentScene; flush earlier to interleave
+// with immediate-mode drawing or before EndMode2D to keep its camera.
+void SubmitSprite(const Sprite* sprite);
+void DrawSprite(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin,
+                float rotation, Color tint, int layer);
+bool FlushSprites();
+void CloseSpriteBatch();
+
+SpriteBatchStats* GetSpriteBatchStats();
+
+#endif
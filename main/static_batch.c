@@ -0,0 +1,351 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Static Geometry Batching Implementation
+//==================================================================
+
+#include "static_batch.h"
+#include "engine.h"
+#include "command_list.h"
+#include "render_pipeline.h"
+#include "texture_atlas.h"
+#include "rlgl.h"
+#include <math.h>
+#include <string.h>
+
+typedef struct
+{
+    bool used;
+    int cellX;
+    int cellZ;
+    unsigned int textureId;
+
+    unsigned int signature;
+    int objectCount;
+    unsigned int pendingSignature;
+    int pendingCount;
+
+    Mesh* mesh;                 // on the heap: pending frames keep drawing a retired one
+    bool uploaded;
+    Vector3 boundsMin;
+    Vector3 boundsMax;
+} StaticBatch;
+
+static StaticBatch staticBatches[MAX_STATIC_BATCHES];
+static int batchOfObject[MAX_OBJECTS];
+static int trackedObjectCount = 0;
+static StaticBatchStats staticStats = { .enabled = true };
+
+static Material batchMaterial;
+static bool batchMaterialReady = false;
+
+static unsigned int HashBytes(unsigned int hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Anything that changes the merged vertices must change this hash
+static unsigned int HashStaticObject(GameObject* obj, Color color, const float uvRect[4])
+{
+    unsigned int hash = 2166136261u;
+    hash = HashBytes(hash, &obj, sizeof(obj));
+    hash = HashBytes(hash, &obj->position, sizeof(Vector3));
+    hash = HashBytes(hash, &obj->size, sizeof(Vector3));
+    hash = HashBytes(hash, &color, sizeof(Color));
+    hash = HashBytes(hash, uvRect, 4 * sizeof(float));
+    return hash;
+}
+
+// Atlased textures batch by page, with their UVs baked into the vertices
+static bool IsStaticCandidate(GameObject* obj, Color* color, unsigned int* textureId, float uvRect[4])
+{
+    if (!obj || !obj->isActive || !obj->isVisible || !obj->isStatic) return false;
+    if (obj->type != OBJ_CUBE && obj->type != OBJ_PLANE) return false;
+
+    *color = GetObjectDrawColor(obj, textureId);
+    RemapAtlasTexture(textureId, uvRect);
+    return color->a == 255;
+}
+
+static int FindStaticBatch(int cellX, int cellZ, unsigned int textureId, bool create)
+{
+    int freeSlot = -1;
+
+    for (int i = 0; i < MAX_STATIC_BATCHES; i++)
+    {
+        StaticBatch* batch = &staticBatches[i];
+        if (!batch->used)
+        {
+            if (freeSlot < 0) freeSlot = i;
+            continue;
+        }
+
+        if (batch->cellX == cellX && batch->cellZ == cellZ && batch->textureId == textureId) return i;
+    }
+
+    if (!create || freeSlot < 0) return -1;
+
+    StaticBatch* batch = &staticBatches[freeSlot];
+    memset(batch, 0, sizeof(StaticBatch));
+    batch->used = true;
+    batch->cellX = cellX;
+    batch->cellZ = cellZ;
+    batch->textureId = textureId;
+    return freeSlot;
+}
+
+static void ReleaseBatchMesh(StaticBatch* batch)
+{
+    if (batch->uploaded) RetireMesh(batch->mesh);
+
+    batch->mesh = NULL;
+    batch->uploaded = false;
+}
+
+static void AppendBox(Mesh* mesh, int box, Vector3 center, Vector3 size, Color color, const float uvRect[4])
+{
+    // Per face: normal, u axis, v axis with u x v = normal (CCW from outside)
+    static const float faces[6][3][3] = {
+        {{ 0, 0, 1}, { 1, 0, 0}, {0, 1, 0}},
+        {{ 0, 0,-1}, {-1, 0, 0}, {0, 1, 0}},
+        {{ 0, 1, 0}, { 1, 0, 0}, {0, 0,-1}},
+        {{ 0,-1, 0}, { 1, 0, 0}, {0, 0, 1}},
+        {{ 1, 0, 0}, { 0, 0,-1}, {0, 1, 0}},
+        {{-1, 0, 0}, { 0, 0, 1}, {0, 1, 0}}
+    };
+    static const float corners[4][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+    float half[3] = {size.x * 0.5f, size.y * 0.5f, size.z * 0.5f};
+    float origin[3] = {center.x, center.y, center.z};
+
+    for (int f = 0; f < 6; f++)
+    {
+        int base = box * 24 + f * 4;
+
+        for (int c = 0; c < 4; c++)
+        {
+            int v = base + c;
+            for (int axis = 0; axis < 3; axis++)
+            {
+                float offset = faces[f][0][axis] + faces[f][1][axis] * corners[c][0] +
+                               faces[f][2][axis] * corners[c][1];
+                mesh->vertices[v*3 + axis] = origin[axis] + offset * half[axis];
+                mesh->normals[v*3 + axis] = faces[f][0][axis];
+            }
+
+            mesh->texcoords[v*2 + 0] = uvRect[0] + (corners[c][0] + 1.0f) * 0.5f * uvRect[2];
+            mesh->texcoords[v*2 + 1] = uvRect[1] + (corners[c][1] + 1.0f) * 0.5f * uvRect[3];
+            mesh->colors[v*4 + 0] = color.r;
+            mesh->colors[v*4 + 1] = color.g;
+            mesh->colors[v*4 + 2] = color.b;
+            mesh->colors[v*4 + 3] = color.a;
+        }
+
+        unsigned short* index = &mesh->indices[(box * 6 + f) * 6];
+        index[0] = (unsigned short)base;
+        index[1] = (unsigned short)(base + 1);
+        index[2] = (unsigned short)(base + 2);
+        index[3] = (unsigned short)base;
+        index[4] = (unsigned short)(base + 2);
+        index[5] = (unsigned short)(base + 3);
+    }
+}
+
+static void RebuildStaticBatch(int batchIndex)
+{
+    StaticBatch* batch = &staticBatches[batchIndex];
+    GameObject** objects = GetObjects();
+    int boxes = batch->pendingCount;
+
+    ReleaseBatchMesh(batch);
+
+    Mesh* uploaded = (Mesh*)malloc(sizeof(Mesh));
+    Mesh mesh = {0};
+    mesh.vertexCount = boxes * 24;
+    mesh.triangleCount = boxes * 12;
+    mesh.vertices = (float*)calloc(mesh.vertexCount * 3, sizeof(float));
+    mesh.normals = (float*)calloc(mesh.vertexCount * 3, sizeof(float));
+    mesh.texcoords = (float*)calloc(mesh.vertexCount * 2, sizeof(float));
+    mesh.colors = (unsigned char*)calloc(mesh.vertexCount * 4, sizeof(unsigned char));
+    mesh.indices = (unsigned short*)calloc(mesh.triangleCount * 3, sizeof(unsigned short));
+
+    if (!uploaded || !mesh.vertices || !mesh.normals || !mesh.texcoords || !mesh.colors || !mesh.indices)
+    {
+        printf("Warning: Out of memory building static batch\n");
+        free(uploaded);
+        free(mesh.vertices);
+        free(mesh.normals);
+        free(mesh.texcoords);
+        free(mesh.colors);
+        free(mesh.indices);
+        return;
+    }
+
+    int box = 0;
+    for (int i = 0; i < trackedObjectCount && box < boxes; i++)
+    {
+        if (batchOfObject[i] != batchIndex) continue;
+
+        GameObject* obj = objects[i];
+        unsigned int textureId;
+        float uvRect[4];
+        Color color = GetObjectDrawColor(obj, &textureId);
+        RemapAtlasTexture(&textureId, uvRect);
+        Vector3 half = {obj->size.x * 0.5f, obj->size.y * 0.5f, obj->size.z * 0.5f};
+        Vector3 lo = Vector3Subtract(obj->position, half);
+        Vector3 hi = Vector3Add(obj->position, half);
+
+        if (box == 0)
+        {
+            batch->boundsMin = lo;
+            batch->boundsMax = hi;
+        }
+        else
+        {
+            batch->boundsMin = (Vector3){fminf(batch->boundsMin.x, lo.x), fminf(batch->boundsMin.y, lo.y), fminf(batch->boundsMin.z, lo.z)};
+            batch->boundsMax = (Vector3){fmaxf(batch->boundsMax.x, hi.x), fmaxf(batch->boundsMax.y, hi.y), fmaxf(batch->boundsMax.z, hi.z)};
+        }
+
+        AppendBox(&mesh, box++, obj->position, obj->size, color, uvRect);
+    }
+
+    UploadMesh(&mesh, false);
+    *uploaded = mesh;
+    batch->mesh = uploaded;
+    batch->uploaded = true;
+    batch->signature = batch->pendingSignature;
+    batch->objectCount = batch->pendingCount;
+    staticStats.rebuilds++;
+}
+
+void UpdateStaticBatches()
+{
+    GameObject** objects = GetObjects();
+    int objectCount = *GetObjectCount();
+
+    staticStats.rebuilds = 0;
+    staticStats.objectsBatched = 0;
+    trackedObjectCount = objectCount;
+
+    for (int b = 0; b < MAX_STATIC_BATCHES; b++)
+    {
+        staticBatches[b].pendingSignature = 0;
+        staticBatches[b].pendingCount = 0;
+    }
+
+    for (int i = 0; i < objectCount; i++)
+    {
+        Color color;
+        unsigned int textureId;
+        float uvRect[4];
+
+        batchOfObject[i] = -1;
+        if (!staticStats.enabled || !IsStaticCandidate(objects[i], &color, &textureId, uvRect)) continue;
+
+        int cellX = (int)floorf(objects[i]->position.x / STATIC_CELL_SIZE);
+        int cellZ = (int)floorf(objects[i]->position.z / STATIC_CELL_SIZE);
+        int b = FindStaticBatch(cellX, cellZ, textureId, true);
+        if (b < 0 || staticBatches[b].pendingCount >= MAX_STATIC_BATCH_BOXES) continue;
+
+        // Order-independent so reshuffling objects[] doesn't force a rebuild
+        staticBatches[b].pendingSignature += HashStaticObject(objects[i], color, uvRect);
+        staticBatches[b].pendingCount++;
+        batchOfObject[i] = b;
+        staticStats.objectsBatched++;
+    }
+
+    if (!batchMaterialReady)
+    {
+        batchMaterial = LoadMaterialDefault();
+        batchMaterial.shader = GetRenderMeshShader();
+        batchMaterialReady = true;
+    }
+
+    staticStats.batches = 0;
+    for (int b = 0; b < MAX_STATIC_BATCHES; b++)
+    {
+        StaticBatch* batch = &staticBatches[b];
+        if (!batch->used) continue;
+
+        if (batch->pendingCount == 0)
+        {
+            ReleaseBatchMesh(batch);
+            batch->used = false;
+            continue;
+        }
+
+        if (!batch->uploaded || batch->pendingSignature != batch->signature ||
+            batch->pendingCount != batch->objectCount)
+        {
+            RebuildStaticBatch(b);
+        }
+        staticStats.batches++;
+    }
+}
+
+int RecordStaticBatches(RenderCommandList* list)
+{
+    staticStats.drawCalls = 0;
+    staticStats.cellsCulled = 0;
+
+    for (int b = 0; b < MAX_STATIC_BATCHES; b++)
+    {
+        StaticBatch* batch = &staticBatches[b];
+        if (!batch->used || !batch->uploaded) continue;
+
+        Vector3 center = Vector3Scale(Vector3Add(batch->boundsMin, batch->boundsMax), 0.5f);
+        float radius = Vector3Length(Vector3Subtract(batch->boundsMax, batch->boundsMin)) * 0.5f;
+        if (!IsSphereInView(center, radius, CULL_STATIC))
+        {
+            staticStats.cellsCulled++;
+            continue;
+        }
+
+        Matrix identity = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+        RecordMeshCommand(list, RENDER_PASS_GEOMETRY, batch->mesh, &batchMaterial,
+                          batch->textureId ? batch->textureId : rlGetTextureIdDefault(), WHITE, identity, 0);
+        staticStats.drawCalls++;
+    }
+
+    return staticStats.drawCalls;
+}
+
+bool IsObjectStaticBatched(int objectIndex)
+{
+    if (objectIndex < 0 || objectIndex >= trackedObjectCount) return false;
+    return batchOfObject[objectIndex] >= 0;
+}
+
+void CloseStaticBatches()
+{
+    for (int b = 0; b < MAX_STATIC_BATCHES; b++)
+    {
+        ReleaseBatchMesh(&staticBatches[b]);
+        staticBatches[b].used = false;
+    }
+
+    if (batchMaterialReady)
+    {
+        // The mesh shader and textures aren't ours to unload
+        batchMaterial.maps[MATERIAL_MAP_DIFFUSE].texture.id = rlGetTextureIdDefault();
+        batchMaterial.shader.id = rlGetShaderIdDefault();
+        UnloadMaterial(batchMaterial);
+        batchMaterialReady = false;
+    }
+}
+
+void SetStaticBatchingEnabled(bool enabled)
+{
+    staticStats.enabled = enabled;
+    printf("Static batching %s\n", enabled ? "enabled" : "disabled");
+}
+
+StaticBatchStats* GetStaticBatchStats()
+{
+    return &staticStats;
+}
@@ -0,0 +1,44 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Static Geometry Batching Module
+//==================================================================
+
+#ifndef STATIC_BATCH_H
+#define STATIC_BATCH_H
+
+#include "raylib.h"
+#include "objects.h"
+#include "command_list.h"
+#include <stdbool.h>
+
+#define STATIC_CELL_SIZE 16.0f
+#define MAX_STATIC_BATCHES 128
+#define MAX_STATIC_BATCH_BOXES 2700   // 24 vertices each, 16-bit indices
+
+typedef struct
+{
+    bool enabled;
+    int batches;
+    int objectsBatched;
+    int rebuilds;
+    int drawCalls;
+    int cellsCulled;
+} StaticBatchStats;
+
+// Opaque isStatic cubes and planes are merged per (cell, texture) into one
+// mesh with colors baked into the vertices. Cells are rebuilt only when
+// their set of objects, or one of those objects, changes. Rebuilds upload
+// meshes, so UpdateStaticBatches runs on the main thread before a frame
+// records; RecordStaticBatches then culls the cells on the recording
+// thread and returns the draws it recorded.
+void UpdateStaticBatches();
+int RecordStaticBatches(RenderCommandList* list);
+bool IsObjectStaticBatched(int objectIndex);
+void CloseStaticBatches();
+
+void SetStaticBatchingEnabled(bool enabled);
+StaticBatchStats* GetStaticBatchStats();
+
+#endif
@@ -0,0 +1,145 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Render Command List Test (headless)
+//
+//Records a frame on the null backend with CPU-only meshes, serializes
+//it, replays it and checks the counts and the bytes survive the round
+//trip. Needs no window or GL context; exits non-zero if any check fails.
+//==================================================================
+
+#include "command_list.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_BUFFER_SIZE (1 << 21)
+
+static int failures = 0;
+static unsigned char capture[TEST_BUFFER_SIZE];
+static unsigned char replayed[TEST_BUFFER_SIZE];
+static InstanceData instances[RENDER_INSTANCE_CAPACITY];
+
+#define CHECK(condition, name) \
+    do { \
+        if (condition) printf("  ok    %s\n", name); \
+        else { printf("  FAIL  %s\n", name); failures++; } \
+    } while (0)
+
+// Never uploaded: the null backend only reads ids and counts
+static Mesh cube = { .vertexCount = 24, .triangleCount = 12, .vaoId = 1 };
+static Mesh sphere = { .vertexCount = 289, .triangleCount = 512, .vaoId = 2 };
+static Mesh quad = { .vertexCount = 4, .triangleCount = 2, .vaoId = 3 };
+static Material meshMaterial = { .shader = { .id = 7 } };
+
+static void RecordFrame()
+{
+    ResetRenderCommands();
+
+    // Two opaque runs, a static batch, the shadow pass and particles
+    PushInstancesCommand(RENDER_PASS_GEOMETRY, &cube, 11, instances, 300, 0);
+    PushInstancesCommand(RENDER_PASS_GEOMETRY, &sphere, 0, instances, 40, 0);
+    PushMeshCommand(RENDER_PASS_GEOMETRY, &cube, &meshMaterial, 12, WHITE, (Matrix){ 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 }, 0);
+    SubmitRenderCommands();
+
+    PushInstancesCommand(RENDER_PASS_SHADOW_DEPTH, &cube, 0, instances, 300, RENDER_STATE_NO_CULLING);
+    SubmitRenderCommands();
+
+    PushInstancesCommand(RENDER_PASS_EFFECTS, &quad, 0, instances, 500, RENDER_STATE_NO_DEPTH_WRITE);
+    SubmitRenderCommands();
+}
+
+static void TestRecord()
+{
+    printf("record\n");
+
+    RecordFrame();
+    RenderCommandStats* stats = GetRenderCommandStats();
+    int count = 0;
+    const RenderCommand* commands = GetRenderCommands(&count);
+
+    CHECK(count == 5 && stats->commands == 5, "five commands recorded");
+    CHECK(stats->instances == 300 + 40 + 1 + 300 + 500, "instances counted");
+    CHECK(stats->triangles == 300 * 12 + 40 * 512 + 12 + 300 * 12 + 500 * 2, "triangles counted");
+    CHECK(stats->stateChanges == 5, "every command changes mesh, texture or state");
+    CHECK(stats->submits == 3, "one submit per pass");
+    CHECK(commands[2].type == RENDER_COMMAND_MESH && commands[2].material == &meshMaterial, "mesh command keeps its material");
+}
+
+static void TestSplit()
+{
+    printf("oversized run\n");
+
+    ResetRenderCommands();
+    PushInstancesCommand(RENDER_PASS_GEOMETRY, &cube, 0, instances, RENDER_INSTANCE_CAPACITY, 0);
+    PushInstancesCommand(RENDER_PASS_GEOMETRY, &cube, 0, instances, 10, 0);
+
+    RenderCommandStats* stats = GetRenderCommandStats();
+    CHECK(stats->overflows == 1, "a full instance pool flushes once");
+    CHECK(stats->instances == RENDER_INSTANCE_CAPACITY + 10, "no instances lost across the flush");
+}
+
+static void TestReplay()
+{
+    printf("serialize and replay\n");
+
+    RecordFrame();
+    RenderCommandStats recorded = *GetRenderCommandStats();
+    size_t size = SerializeRenderCommands(capture, sizeof(capture));
+
+    CHECK(size == GetRenderCommandsSize() && size > sizeof(RenderCommandHeader), "frame serialized");
+    CHECK(SerializeRenderCommands(capture, size - 1) == 0, "short buffer refused");
+
+    ResetRenderCommands();
+    CHECK(ReplayRenderCommands(capture, size), "replay accepted");
+
+    RenderCommandStats* stats = GetRenderCommandStats();
+    CHECK(stats->commands == recorded.commands && stats->instances == recorded.instances &&
+          stats->triangles == recorded.triangles && stats->stateChanges == recorded.stateChanges,
+          "replayed counts match the recording");
+    CHECK(stats->submits == 1, "replay submits once");
+
+    size_t replayedSize = SerializeRenderCommands(replayed, sizeof(replayed));
+    CHECK(replayedSize == size && memcmp(capture, replayed, size) == 0, "replayed frame serializes to the same bytes");
+
+    ((RenderCommandHeader*)capture)->magic ^= 1u;
+    CHECK(!ReplayRenderCommands(capture, size), "bad magic refused");
+    ((RenderCommandHeader*)capture)->magic ^= 1u;
+
+    CHECK(!ReplayRenderCommands(capture, size - 1), "truncated list refused");
+
+    RenderCommandRecord* records = (RenderCommandRecord*)((RenderCommandHeader*)capture + 1);
+    records[0].instanceCount = 1 << 20;
+    CHECK(!ReplayRenderCommands(capture, size), "instance range past the pool refused");
+}
+
+static void TestRaylibBackend()
+{
+    printf("raylib backend\n");
+
+    RecordFrame();
+    size_t size = SerializeRenderCommands(capture, sizeof(capture));
+
+    SetRenderBackend(RENDER_BACKEND_RAYLIB);
+    CHECK(!ReplayRenderCommands(capture, size), "replay needs the null backend");
+    SetRenderBackend(RENDER_BACKEND_NULL);
+}
+
+int main()
+{
+    for (int i = 0; i < RENDER_INSTANCE_CAPACITY; i++)
+    {
+        instances[i] = (InstanceData){ { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, (float)i, 0, 0, 1 },
+                                       WHITE, { 0.0f, 0.0f, 1.0f, 1.0f } };
+    }
+
+    SetRenderBackend(RENDER_BACKEND_NULL);
+
+    TestRecord();
+    TestSplit();
+    TestReplay();
+    TestRaylibBackend();
+
+    printf("%s: %d failed\n", failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+}
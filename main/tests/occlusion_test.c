@@ -0,0 +1,167 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Occlusion Culling Test (headless)
+//
+//Rasterizes a wall in front of the camera and checks the min/max depth
+//pyramid and the occluded/visible verdicts for boxes around it. Needs
+//no window or GL context; exits non-zero if any check fails.
+//==================================================================
+
+#include "occlusion.h"
+#include "vector_math.h"
+#include <stdio.h>
+#include <math.h>
+
+static int failures = 0;
+
+#define CHECK(condition, name) \
+    do { \
+        if (condition) printf("  ok    %s\n", name); \
+        else { printf("  FAIL  %s\n", name); failures++; } \
+    } while (0)
+
+// Same conventions as raylib's MatrixPerspective and MatrixLookAt
+static Matrix Perspective(float fovy, float aspect, float nearPlane, float farPlane)
+{
+    float top = nearPlane * tanf(fovy * 0.5f * DEG2RAD);
+    float right = top * aspect;
+    Matrix m = {0};
+
+    m.m0 = nearPlane / right;
+    m.m5 = nearPlane / top;
+    m.m10 = -(farPlane + nearPlane) / (farPlane - nearPlane);
+    m.m11 = -1.0f;
+    m.m14 = -2.0f * farPlane * nearPlane / (farPlane - nearPlane);
+    return m;
+}
+
+static Matrix LookAt(Vector3 eye, Vector3 target, Vector3 up)
+{
+    Vector3 z = Vector3Normalize(Vector3Subtract(eye, target));
+    Vector3 x = Vector3Normalize(Vector3CrossProduct(up, z));
+    Vector3 y = Vector3CrossProduct(z, x);
+
+    return (Matrix){
+        x.x, x.y, x.z, -Vector3DotProduct(x, eye),
+        y.x, y.y, y.z, -Vector3DotProduct(y, eye),
+        z.x, z.y, z.z, -Vector3DotProduct(z, eye),
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+}
+
+static void BeginView(Vector3 eye, Vector3 target)
+{
+    Matrix view = LookAt(eye, target, (Vector3){ 0.0f, 1.0f, 0.0f });
+    BeginOcclusionFrame(MatrixMul(view, Perspective(60.0f, 16.0f / 9.0f, 0.01f, 1000.0f)));
+}
+
+static bool PyramidConsistent()
+{
+    for (int level = 1; level < OCCLUSION_LEVELS; level++)
+    {
+        int srcWidth, width, height;
+        const float* srcMin = GetOcclusionDepth(level - 1, false, &srcWidth, NULL);
+        const float* srcMax = GetOcclusionDepth(level - 1, true, NULL, NULL);
+        const float* levelMin = GetOcclusionDepth(level, false, &width, &height);
+        const float* levelMax = GetOcclusionDepth(level, true, NULL, NULL);
+
+        if (width != OCCLUSION_WIDTH >> level || height != OCCLUSION_HEIGHT >> level) return false;
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                int s = (y * 2) * srcWidth + x * 2;
+                float lo = fminf(fminf(srcMin[s], srcMin[s + 1]), fminf(srcMin[s + srcWidth], srcMin[s + srcWidth + 1]));
+                float hi = fmaxf(fmaxf(srcMax[s], srcMax[s + 1]), fmaxf(srcMax[s + srcWidth], srcMax[s + srcWidth + 1]));
+
+                if (levelMin[y * width + x] != lo || levelMax[y * width + x] != hi) return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void TestEmptyFrame()
+{
+    printf("empty frame\n");
+
+    BeginView((Vector3){ 0.0f, 1.7f, 10.0f }, (Vector3){ 0.0f, 1.7f, 0.0f });
+    FinishOcclusionFrame();
+
+    int width, height;
+    const float* top = GetOcclusionDepth(OCCLUSION_LEVELS - 1, false, &width, &height);
+    bool empty = true;
+    for (int i = 0; i < width * height; i++) empty = empty && top[i] == 1.0f;
+
+    CHECK(empty, "nothing rasterized leaves the pyramid at the far plane");
+    CHECK(!IsBoxOccluded((Vector3){ -0.5f, 0.5f, -6.0f }, (Vector3){ 0.5f, 1.5f, -5.0f }), "box with no occluders is visible");
+}
+
+static void TestWall()
+{
+    printf("wall 6x4 at z=0, camera at z=10\n");
+
+    BeginView((Vector3){ 0.0f, 1.7f, 10.0f }, (Vector3){ 0.0f, 1.7f, 0.0f });
+    RasterizeOccluderBox((Vector3){ -3.0f, 0.0f, -1.0f }, (Vector3){ 3.0f, 4.0f, 1.0f });
+    FinishOcclusionFrame();
+
+    CHECK(IsOcclusionReady(), "ready after FinishOcclusionFrame");
+    CHECK(GetOcclusionStats()->trianglesRasterized > 0, "occluder triangles rasterized");
+    CHECK(PyramidConsistent(), "each level is the min/max of the four texels below it");
+
+    int width, height;
+    const float* nearest = GetOcclusionDepth(OCCLUSION_LEVELS - 1, false, &width, &height);
+    const float* farthest = GetOcclusionDepth(OCCLUSION_LEVELS - 1, true, NULL, NULL);
+    CHECK(nearest[0] < 1.0f && farthest[0] == 1.0f, "top level holds the wall as nearest and empty sky as farthest");
+
+    CHECK(IsBoxOccluded((Vector3){ -0.5f, 0.5f, -6.0f }, (Vector3){ 0.5f, 1.5f, -5.0f }), "box fully behind the wall is occluded");
+    CHECK(IsBoxOccluded((Vector3){ -0.5f, 0.5f, -3.0f }, (Vector3){ 0.5f, 2.0f, -2.0f }), "box just behind the wall is occluded");
+    CHECK(!IsBoxOccluded((Vector3){ -0.5f, 3.5f, -6.0f }, (Vector3){ 0.5f, 6.0f, -5.0f }), "box peeking over the top is visible");
+    CHECK(!IsBoxOccluded((Vector3){ 2.5f, 0.5f, -6.0f }, (Vector3){ 5.0f, 1.5f, -5.0f }), "box straddling the wall's edge is visible");
+    CHECK(!IsBoxOccluded((Vector3){ 7.5f, 0.5f, -6.0f }, (Vector3){ 8.5f, 1.5f, -5.0f }), "box beside the wall is visible");
+    CHECK(!IsBoxOccluded((Vector3){ -0.5f, 0.5f, 4.0f }, (Vector3){ 0.5f, 1.5f, 5.0f }), "box in front of the wall is visible");
+    CHECK(!IsBoxOccluded((Vector3){ -3.0f, 0.0f, -1.0f }, (Vector3){ 3.0f, 4.0f, 1.0f }), "the occluder does not hide itself");
+    CHECK(!IsBoxOccluded((Vector3){ -0.5f, 0.5f, 9.0f }, (Vector3){ 0.5f, 1.5f, 11.0f }), "box crossing the near plane is visible");
+}
+
+static void TestNearPlaneClip()
+{
+    printf("side wall running past the camera\n");
+
+    // Spans from behind the eye to far ahead, so its triangles need clipping
+    BeginView((Vector3){ 0.0f, 1.7f, 0.5f }, (Vector3){ 0.0f, 1.7f, -10.0f });
+    RasterizeOccluderBox((Vector3){ -50.0f, 0.0f, -40.0f }, (Vector3){ -0.5f, 6.0f, 5.0f });
+    FinishOcclusionFrame();
+
+    CHECK(PyramidConsistent(), "pyramid stays consistent after clipping");
+    CHECK(IsBoxOccluded((Vector3){ -7.0f, 0.0f, -20.0f }, (Vector3){ -5.0f, 2.0f, -18.0f }), "box behind the side wall is occluded");
+    CHECK(!IsBoxOccluded((Vector3){ 5.0f, 0.0f, -20.0f }, (Vector3){ 7.0f, 2.0f, -18.0f }), "box on the open side is visible");
+    CHECK(!IsBoxOccluded((Vector3){ -0.3f, 0.0f, -20.0f }, (Vector3){ 0.3f, 2.0f, -18.0f }), "box in the corridor along the wall is visible");
+}
+
+static void TestDisabled()
+{
+    printf("disabled\n");
+
+    BeginView((Vector3){ 0.0f, 1.7f, 10.0f }, (Vector3){ 0.0f, 1.7f, 0.0f });
+    RasterizeOccluderBox((Vector3){ -3.0f, 0.0f, -1.0f }, (Vector3){ 3.0f, 4.0f, 1.0f });
+    FinishOcclusionFrame();
+    SetOcclusionEnabled(false);
+
+    CHECK(!IsBoxOccluded((Vector3){ -0.5f, 0.5f, -6.0f }, (Vector3){ 0.5f, 1.5f, -5.0f }), "nothing is occluded while disabled");
+    SetOcclusionEnabled(true);
+}
+
+int main()
+{
+    TestEmptyFrame();
+    TestWall();
+    TestNearPlaneClip();
+    TestDisabled();
+
+    printf("%s: %d failed\n", failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+}
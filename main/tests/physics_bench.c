@@ -0,0 +1,172 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Physics Pair Benchmark (headless)
+//
+//Times every body pair of a scattered and a packed scene through the
+//AABB gate, the exact shape-pair dispatch and the bounding-sphere test
+//the engine used before, and reports each test's false positives
+//against the exact result. Needs no window or GL context.
+//==================================================================
+
+#include "engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#define BENCH_BODIES MAX_OBJECTS
+#define BENCH_REPEATS 200
+
+typedef struct
+{
+    const char* name;
+    float extent;                   // half width of the spawn area
+    float height;
+} BenchScene;
+
+static GameObject bodies[BENCH_BODIES];
+static GameObject* bodyList[BENCH_BODIES];
+
+static float RandomRange(float min, float max)
+{
+    return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+static void BuildScene(const BenchScene* scene)
+{
+    srand(1234);
+
+    for (int i = 0; i < BENCH_BODIES; i++)
+    {
+        GameObject* obj = &bodies[i];
+        *obj = (GameObject){0};
+
+        int kind = i % 10;
+        if (i == 0) obj->type = OBJ_PLAYER;
+        else if (kind < 4) obj->type = OBJ_CUBE;
+        else if (kind < 8) obj->type = OBJ_SPHERE;
+        else obj->type = OBJ_CYLINDER;
+
+        if (obj->type == OBJ_PLAYER)
+        {
+            obj->size = (Vector3){ 0.6f, 1.8f, 0.6f };
+        }
+        else if (obj->type == OBJ_SPHERE)
+        {
+            float d = RandomRange(0.5f, 2.0f);
+            obj->size = (Vector3){ d, d, d };
+        }
+        else
+        {
+            obj->size = (Vector3){ RandomRange(0.5f, 3.0f), RandomRange(0.5f, 3.0f), RandomRange(0.5f, 3.0f) };
+        }
+
+        obj->position = (Vector3){ RandomRange(-scene->extent, scene->extent), RandomRange(0.0f, scene->height),
+                                   RandomRange(-scene->extent, scene->extent) };
+        obj->hasCollision = true;
+        obj->isActive = true;
+        bodyList[i] = obj;
+    }
+}
+
+// CheckCollision before the shape-pair dispatch: boxes widened to the
+// sphere around their largest extent whenever a sphere was involved
+static bool LegacySphereTest(GameObject* a, GameObject* b)
+{
+    if (a->type != OBJ_SPHERE && b->type != OBJ_SPHERE) return CheckAABBCollision(a, b);
+
+    float radiusA = (a->type == OBJ_SPHERE) ? a->size.x / 2 : fmaxf(a->size.x, fmaxf(a->size.y, a->size.z)) / 2;
+    float radiusB = (b->type == OBJ_SPHERE) ? b->size.x / 2 : fmaxf(b->size.x, fmaxf(b->size.y, b->size.z)) / 2;
+
+    return CheckSphereCollision(a->position, radiusA, b->position, radiusB);
+}
+
+static double Seconds(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void RunScene(const BenchScene* scene)
+{
+    BuildScene(scene);
+
+    int pairs = 0, aabbHits = 0, exactHits = 0, legacyHits = 0, legacyFalse = 0, legacyMissed = 0;
+    ContactInfo contact;
+
+    for (int i = 0; i < BENCH_BODIES; i++)
+    {
+        for (int j = i + 1; j < BENCH_BODIES; j++)
+        {
+            bool aabb = CheckAABBCollision(bodyList[i], bodyList[j]);
+            bool exact = aabb && ComputeContact(bodyList[i], bodyList[j], &contact);
+            bool legacy = LegacySphereTest(bodyList[i], bodyList[j]);
+
+            pairs++;
+            aabbHits += aabb;
+            exactHits += exact;
+            legacyHits += legacy;
+            if (legacy && !exact) legacyFalse++;
+            if (!legacy && exact) legacyMissed++;
+        }
+    }
+
+    // Each loop keeps a running count so the compiler can't drop the tests
+    volatile int sink = 0;
+
+    clock_t start = clock();
+    for (int r = 0; r < BENCH_REPEATS; r++)
+        for (int i = 0; i < BENCH_BODIES; i++)
+            for (int j = i + 1; j < BENCH_BODIES; j++)
+                sink += CheckAABBCollision(bodyList[i], bodyList[j]);
+    double aabbTime = Seconds(start);
+
+    start = clock();
+    for (int r = 0; r < BENCH_REPEATS; r++)
+        for (int i = 0; i < BENCH_BODIES; i++)
+            for (int j = i + 1; j < BENCH_BODIES; j++)
+                sink += CheckAABBCollision(bodyList[i], bodyList[j]) && ComputeContact(bodyList[i], bodyList[j], &contact);
+    double exactTime = Seconds(start);
+
+    start = clock();
+    for (int r = 0; r < BENCH_REPEATS; r++)
+        for (int i = 0; i < BENCH_BODIES; i++)
+            for (int j = i + 1; j < BENCH_BODIES; j++)
+                sink += LegacySphereTest(bodyList[i], bodyList[j]);
+    double legacyTime = Seconds(start);
+
+    double total = (double)pairs * BENCH_REPEATS;
+
+    printf("%s: %d bodies, %d pairs, %d exact contacts\n", scene->name, BENCH_BODIES, pairs, exactHits);
+    printf("  %-22s %8.1f Mpairs/s  %6d hits  %5.1f%% false positives\n", "AABB gate",
+           total / aabbTime / 1e6, aabbHits, aabbHits ? 100.0 * (aabbHits - exactHits) / aabbHits : 0.0);
+    printf("  %-22s %8.1f Mpairs/s  %6d hits  %5.1f%% false positives\n", "AABB + shape dispatch",
+           total / exactTime / 1e6, exactHits, 0.0);
+    printf("  %-22s %8.1f Mpairs/s  %6d hits  %5.1f%% false positives, %d missed\n", "legacy sphere test",
+           total / legacyTime / 1e6, legacyHits, legacyHits ? 100.0 * legacyFalse / legacyHits : 0.0, legacyMissed);
+
+    PlayerPhysicsSettings settings = { .gravity = -9.81f, .playerHeight = 1.8f, .playerRadius = 0.3f,
+                                       .groundFriction = 0.9f };
+    start = clock();
+    for (int r = 0; r < BENCH_REPEATS; r++) SimulatePhysics(bodyList, BENCH_BODIES, &settings, 1.0f / 60.0f);
+    double stepTime = Seconds(start);
+
+    PhysicsStats* stats = GetPhysicsStats();
+    printf("  SimulatePhysics        %8.3f ms/step, last step %d narrowphase tests, %d rejected, %d contacts\n",
+           stepTime * 1000.0 / BENCH_REPEATS, stats->narrowphaseTests, stats->narrowphaseRejects, stats->contacts);
+    (void)sink;
+}
+
+int main()
+{
+    static const BenchScene scenes[] = {
+        { "scattered arena", 40.0f, 4.0f },
+        { "packed pile", 8.0f, 6.0f }
+    };
+
+    InitPhysics();
+    for (int i = 0; i < (int)(sizeof(scenes) / sizeof(scenes[0])); i++) RunScene(&scenes[i]);
+
+    return 0;
+}
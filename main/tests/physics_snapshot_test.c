@@ -0,0 +1,146 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Physics Snapshot Test (headless)
+//
+//Drops a pile of untextured bodies, saves the world, steps it, restores
+//it and checks that re-saving and replaying give byte-identical
+//snapshots, then reports how long a save and a restore take. Needs no
+//window or GL context; exits non-zero if any check fails.
+//==================================================================
+
+#include "engine.h"
+#include "physics_snapshot.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define TEST_BUFFER_SIZE (1 << 20)
+#define TEST_STEPS 120
+#define TEST_TIMING_REPEATS 1000
+#define TEST_DT (1.0f / 60.0f)
+
+static int failures = 0;
+static unsigned char saved[TEST_BUFFER_SIZE];
+static unsigned char resaved[TEST_BUFFER_SIZE];
+static unsigned char stepped[TEST_BUFFER_SIZE];
+static unsigned char replayed[TEST_BUFFER_SIZE];
+
+#define CHECK(condition, name) \
+    do { \
+        if (condition) printf("  ok    %s\n", name); \
+        else { printf("  FAIL  %s\n", name); failures++; } \
+    } while (0)
+
+static void BuildWorld()
+{
+    SetPlayerPhysicsSettings(5.0f, 10.0f, 12.0f, -25.0f, 1.8f, 0.3f, 0.3f, 0.8f);
+    InitPhysics();
+
+    CreatePlane("Ground", 0.0f, 0.0f, 0.0f, 40.0f, 40.0f, GRAY);
+    CreatePlayer("Player", 0.0f, 1.0f, -6.0f, true, true);
+
+    for (int i = 0; i < 60; i++)
+    {
+        float x = (float)(i % 6) * 1.1f - 3.0f;
+        float y = 2.0f + (float)(i / 6) * 1.2f;
+        float z = (float)(i % 3) * 0.7f;
+
+        if (i % 3 == 0) CreateSphere(NULL, x, y, z, true, true, RED, 0.5f);
+        else CreateCube(NULL, x, y, z, true, true, NULL, BLUE);
+    }
+}
+
+static void Step(int steps)
+{
+    for (int i = 0; i < steps; i++) UpdatePhysics(TEST_DT);
+}
+
+static void TestRoundTrip()
+{
+    printf("save and restore\n");
+
+    Step(30);
+
+    // Different garbage under each save: padding must not leak into either
+    memset(saved, 0xAA, sizeof(saved));
+    memset(resaved, 0x55, sizeof(resaved));
+    size_t size = SavePhysicsSnapshot(saved, sizeof(saved));
+    size_t resize = SavePhysicsSnapshot(resaved, sizeof(resaved));
+
+    CHECK(size == GetPhysicsSnapshotSize() && size > sizeof(PhysicsSnapshotHeader), "world saved");
+    CHECK(resize == size && memcmp(saved, resaved, size) == 0, "two saves of one world are byte-identical");
+    CHECK(SavePhysicsSnapshot(resaved, size - 1) == 0, "short buffer refused");
+
+    Vector3 before = GetObjects()[10]->position;
+    Step(TEST_STEPS);
+    SavePhysicsSnapshot(stepped, sizeof(stepped));
+    CHECK(memcmp(saved, stepped, size) != 0, "stepping changes the snapshot");
+
+    CHECK(RestorePhysicsSnapshot(saved, size), "restore accepted");
+    Vector3 after = GetObjects()[10]->position;
+    CHECK(before.x == after.x && before.y == after.y && before.z == after.z, "bodies back at the saved positions");
+    CHECK(*GetPlayerObject() == GetObjects()[1], "player object restored");
+
+    memset(resaved, 0x55, sizeof(resaved));
+    SavePhysicsSnapshot(resaved, sizeof(resaved));
+    CHECK(memcmp(saved, resaved, size) == 0, "re-save after restore is byte-identical");
+
+    Step(TEST_STEPS);
+    SavePhysicsSnapshot(replayed, sizeof(replayed));
+    CHECK(memcmp(stepped, replayed, size) == 0, "replaying from the snapshot reaches the same state");
+}
+
+static void TestRejects()
+{
+    printf("invalid snapshots\n");
+
+    size_t size = SavePhysicsSnapshot(saved, sizeof(saved));
+    PhysicsSnapshotHeader* header = (PhysicsSnapshotHeader*)saved;
+
+    header->magic ^= 1u;
+    CHECK(!RestorePhysicsSnapshot(saved, size), "bad magic refused");
+    header->magic ^= 1u;
+
+    header->version++;
+    CHECK(!RestorePhysicsSnapshot(saved, size), "other version refused");
+    header->version--;
+
+    CHECK(!RestorePhysicsSnapshot(saved, size - 1), "truncated snapshot refused");
+
+    CreateCube("Late", 0.0f, 20.0f, 0.0f, true, true, NULL, BLUE);
+    CHECK(!RestorePhysicsSnapshot(saved, size), "different body count refused");
+}
+
+static double Microseconds(clock_t start, int repeats)
+{
+    return (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / repeats;
+}
+
+static void ReportTiming()
+{
+    size_t size = SavePhysicsSnapshot(saved, sizeof(saved));
+
+    clock_t start = clock();
+    for (int i = 0; i < TEST_TIMING_REPEATS; i++) SavePhysicsSnapshot(saved, sizeof(saved));
+    double saveTime = Microseconds(start, TEST_TIMING_REPEATS);
+
+    start = clock();
+    for (int i = 0; i < TEST_TIMING_REPEATS; i++) RestorePhysicsSnapshot(saved, size);
+    double restoreTime = Microseconds(start, TEST_TIMING_REPEATS);
+
+    printf("%d bodies, %zu bytes: save %.2f us, restore %.2f us\n", *GetObjectCount(), size, saveTime, restoreTime);
+}
+
+int main()
+{
+    BuildWorld();
+
+    TestRoundTrip();
+    ReportTiming();
+    TestRejects();
+
+    printf("%s: %d failed\n", failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+}
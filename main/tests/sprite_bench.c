@@ -0,0 +1,157 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Sprite Batch Benchmark (needs a window)
+//
+//Runs a 2D scene of moving, rotating sprites over a few textures and
+//layers, drawn once through DrawSprite and once through raylib's
+//DrawTexturePro, and reports the average frame time of each with the
+//frame cap off. Run it on the machine you want numbers for.
+//==================================================================
+
+#include "engine.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_TEXTURES 8
+#define BENCH_LAYERS 4
+#define BENCH_WARMUP_FRAMES 60
+#define BENCH_FRAMES 300
+#define BENCH_SPRITE_SIZE 16.0f
+
+typedef struct
+{
+    Vector2 position;
+    Vector2 velocity;
+    float rotation;
+    float spin;
+    int texture;
+    int layer;
+} BenchSprite;
+
+static BenchSprite sprites[MAX_SPRITES];
+static Texture2D textures[BENCH_TEXTURES];
+static int spriteCount = 0;
+static bool batched = true;
+
+static float RandomRange(float min, float max)
+{
+    return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+static void InitSpriteScene(const char* name, SceneType type)
+{
+    Color colors[BENCH_TEXTURES] = { RED, ORANGE, GOLD, GREEN, SKYBLUE, BLUE, PURPLE, PINK };
+
+    for (int t = 0; t < BENCH_TEXTURES; t++)
+    {
+        Image image = GenImageChecked(16, 16, 4, 4, colors[t], WHITE);
+        textures[t] = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    srand(1234);
+    for (int i = 0; i < MAX_SPRITES; i++)
+    {
+        BenchSprite* sprite = &sprites[i];
+        sprite->position = (Vector2){ RandomRange(0.0f, (float)GetScreenWidth()), RandomRange(0.0f, (float)GetScreenHeight()) };
+        sprite->velocity = (Vector2){ RandomRange(-120.0f, 120.0f), RandomRange(-120.0f, 120.0f) };
+        sprite->rotation = RandomRange(0.0f, 360.0f);
+        sprite->spin = RandomRange(-90.0f, 90.0f);
+        sprite->texture = rand() % BENCH_TEXTURES;
+        sprite->layer = rand() % BENCH_LAYERS;
+    }
+}
+
+static void UpdateSpriteScene(const char* name, SceneType type)
+{
+    float dt = GetFrameTime();
+    float width = (float)GetScreenWidth();
+    float height = (float)GetScreenHeight();
+
+    for (int i = 0; i < spriteCount; i++)
+    {
+        BenchSprite* sprite = &sprites[i];
+        sprite->position.x += sprite->velocity.x * dt;
+        sprite->position.y += sprite->velocity.y * dt;
+        sprite->rotation += sprite->spin * dt;
+
+        if (sprite->position.x < 0.0f || sprite->position.x > width) sprite->velocity.x = -sprite->velocity.x;
+        if (sprite->position.y < 0.0f || sprite->position.y > height) sprite->velocity.y = -sprite->velocity.y;
+    }
+}
+
+static void RenderSpriteScene(const char* name, SceneType type)
+{
+    Rectangle source = { 0.0f, 0.0f, 16.0f, 16.0f };
+    Vector2 origin = { BENCH_SPRITE_SIZE / 2, BENCH_SPRITE_SIZE / 2 };
+
+    for (int i = 0; i < spriteCount; i++)
+    {
+        const BenchSprite* sprite = &sprites[i];
+        Rectangle dest = { sprite->position.x, sprite->position.y, BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE };
+
+        if (batched)
+        {
+            DrawSprite(textures[sprite->texture], source, dest, origin, sprite->rotation, WHITE, sprite->layer);
+        }
+        else
+        {
+            DrawTexturePro(textures[sprite->texture], source, dest, origin, sprite->rotation, WHITE);
+        }
+    }
+}
+
+static void CloseSpriteScene(const char* name, SceneType type)
+{
+    for (int t = 0; t < BENCH_TEXTURES; t++) UnloadTexture(textures[t]);
+}
+
+static double MeasureFrames(int count, bool useBatch)
+{
+    spriteCount = count;
+    batched = useBatch;
+
+    for (int f = 0; f < BENCH_WARMUP_FRAMES && !WindowShouldClose(); f++)
+    {
+        UpdateEngine(GetDeltaTime());
+        RenderAll();
+    }
+
+    double start = GetTime();
+    for (int f = 0; f < BENCH_FRAMES && !WindowShouldClose(); f++)
+    {
+        UpdateEngine(GetDeltaTime());
+        RenderAll();
+    }
+    return (GetTime() - start) * 1000.0 / BENCH_FRAMES;
+}
+
+int main()
+{
+    static const int counts[] = { 1000, 10000, 50000 };
+
+    InitEngine(1280, 720, "Sprite Batch Benchmark", false);
+    SetTargetFPS(0);
+
+    Engine_RegisterScene("Sprites", SCENE_2D, InitSpriteScene, UpdateSpriteScene, RenderSpriteScene, CloseSpriteScene);
+    Engine_SwitchScene("Sprites");
+
+    printf("%d textures, %d layers, %dx%d px sprites, GL version %d\n", BENCH_TEXTURES, BENCH_LAYERS,
+           (int)BENCH_SPRITE_SIZE, (int)BENCH_SPRITE_SIZE, rlGetVersion());
+
+    for (int i = 0; i < (int)(sizeof(counts) / sizeof(counts[0])) && !WindowShouldClose(); i++)
+    {
+        double batchMs = MeasureFrames(counts[i], true);
+        SpriteBatchStats stats = *GetSpriteBatchStats();
+        double rawMs = MeasureFrames(counts[i], false);
+
+        printf("  %6d sprites  DrawSprite %7.2f ms/frame (%d draw calls)  DrawTexturePro %7.2f ms/frame\n",
+               counts[i], batchMs, stats.drawCalls, rawMs);
+    }
+
+    CloseEngine();
+    return 0;
+}
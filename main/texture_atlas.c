@@ -0,0 +1,506 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Texture Atlas Implementation
+//==================================================================
+
+#include "texture_atlas.h"
+#include "texture_loader.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SLOT_EMPTY 0u
+#define SLOT_REMOVED 0xFFFFFFFFu
+
+typedef struct
+{
+    int y;
+    int height;
+    int x;                          // next free column
+} AtlasShelf;
+
+typedef struct
+{
+    Image image;                    // RGBA8, kept for re-uploads and export
+    Texture2D texture;
+    bool dirty;
+    AtlasShelf shelves[MAX_ATLAS_SHELVES];
+    int shelfCount;
+    int nextY;
+} AtlasPage;
+
+typedef struct
+{
+    char key[ATLAS_KEY_LENGTH];
+    int page;
+    int x, y, width, height;        // texels, inside the padding
+    int slotX, slotY, slotWidth, slotHeight;    // padding included
+    int refs;                       // texture ids mapped to it
+    bool used;                      // false once released, slot reusable
+} AtlasEntry;
+
+typedef struct
+{
+    unsigned int textureId;
+    int entry;
+} AtlasSlot;
+
+static AtlasPage atlasPages[MAX_ATLAS_PAGES];
+static AtlasEntry atlasEntries[MAX_ATLAS_ENTRIES];
+static AtlasSlot atlasSlots[ATLAS_TEXTURE_SLOTS];
+static AtlasStats atlasStats = { .enabled = true };
+static int entryCount = 0;         // used and released, in array order
+static long packedArea = 0;
+
+static unsigned int SlotIndex(unsigned int textureId)
+{
+    return (textureId * 2654435761u) & (ATLAS_TEXTURE_SLOTS - 1);
+}
+
+static int FindSlot(unsigned int textureId)
+{
+    unsigned int index = SlotIndex(textureId);
+
+    for (int probe = 0; probe < ATLAS_TEXTURE_SLOTS; probe++)
+    {
+        AtlasSlot* slot = &atlasSlots[(index + probe) & (ATLAS_TEXTURE_SLOTS - 1)];
+        if (slot->textureId == SLOT_EMPTY) return -1;
+        if (slot->textureId == textureId) return (int)((index + probe) & (ATLAS_TEXTURE_SLOTS - 1));
+    }
+    return -1;
+}
+
+static void UpdateUsage()
+{
+    atlasStats.usage = atlasStats.pages > 0 ?
+        (float)packedArea / ((float)atlasStats.pages * ATLAS_PAGE_SIZE * ATLAS_PAGE_SIZE) : 0.0f;
+}
+
+// The texels stay on the page until the slot is packed again
+static void ReleaseEntry(int index)
+{
+    AtlasEntry* entry = &atlasEntries[index];
+
+    entry->used = false;
+    entry->key[0] = '\0';
+    packedArea -= (long)entry->slotWidth * entry->slotHeight;
+    atlasStats.entries--;
+    atlasStats.released++;
+    UpdateUsage();
+}
+
+static void DropReference(int index)
+{
+    if (--atlasEntries[index].refs == 0) ReleaseEntry(index);
+}
+
+static bool InsertSlot(unsigned int textureId, int entry)
+{
+    int existing = FindSlot(textureId);
+    if (existing >= 0)
+    {
+        if (atlasSlots[existing].entry == entry) return true;
+
+        atlasEntries[entry].refs++;
+        DropReference(atlasSlots[existing].entry);
+        atlasSlots[existing].entry = entry;
+        return true;
+    }
+
+    unsigned int index = SlotIndex(textureId);
+    for (int probe = 0; probe < ATLAS_TEXTURE_SLOTS; probe++)
+    {
+        AtlasSlot* slot = &atlasSlots[(index + probe) & (ATLAS_TEXTURE_SLOTS - 1)];
+        if (slot->textureId != SLOT_EMPTY && slot->textureId != SLOT_REMOVED) continue;
+
+        slot->textureId = textureId;
+        slot->entry = entry;
+        atlasEntries[entry].refs++;
+        atlasStats.textures++;
+        return true;
+    }
+    return false;
+}
+
+static int FindEntry(const char* key)
+{
+    for (int i = 0; i < entryCount; i++)
+    {
+        if (atlasEntries[i].used && strcmp(atlasEntries[i].key, key) == 0) return i;
+    }
+    return -1;
+}
+
+// Smallest released slot the padded image fits in
+static int FindReleasedEntry(int width, int height)
+{
+    int best = -1;
+
+    for (int i = 0; i < entryCount; i++)
+    {
+        AtlasEntry* entry = &atlasEntries[i];
+        if (entry->used || entry->slotWidth < width || entry->slotHeight < height) continue;
+        if (best < 0 || entry->slotWidth * entry->slotHeight <
+                        atlasEntries[best].slotWidth * atlasEntries[best].slotHeight) best = i;
+    }
+    return best;
+}
+
+static bool OpenPage(int index)
+{
+    AtlasPage* page = &atlasPages[index];
+
+    memset(page, 0, sizeof(AtlasPage));
+    page->image = GenImageColor(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, BLANK);
+    if (!page->image.data) return false;
+
+    atlasStats.pages++;
+    return true;
+}
+
+// Best-fitting shelf by height; a new shelf when none is within 50% of
+// the entry, so short entries don't waste tall rows
+static bool PlaceInPage(AtlasPage* page, int width, int height, int* x, int* y)
+{
+    int best = -1;
+
+    for (int s = 0; s < page->shelfCount; s++)
+    {
+        AtlasShelf* shelf = &page->shelves[s];
+        if (shelf->height < height || shelf->x + width > ATLAS_PAGE_SIZE) continue;
+        if (best < 0 || shelf->height < page->shelves[best].height) best = s;
+    }
+
+    bool roomForShelf = page->shelfCount < MAX_ATLAS_SHELVES && page->nextY + height <= ATLAS_PAGE_SIZE;
+    if ((best < 0 || page->shelves[best].height > height + height / 2) && roomForShelf)
+    {
+        best = page->shelfCount++;
+        page->shelves[best] = (AtlasShelf){ page->nextY, height, 0 };
+        page->nextY += height;
+    }
+    if (best < 0) return false;
+
+    *x = page->shelves[best].x;
+    *y = page->shelves[best].y;
+    page->shelves[best].x += width;
+    return true;
+}
+
+static int AlignSlot(int size)
+{
+    return (size + ATLAS_PADDING * 2 + ATLAS_ALIGN - 1) & ~(ATLAS_ALIGN - 1);
+}
+
+// Clamped copy over the whole slot, so filtered samples at the entry's
+// edges, and the mip texels built from them, stay inside it
+static void BlitPadded(Image* page, const Image* source, int x, int y, int slotWidth, int slotHeight)
+{
+    unsigned char* dst = (unsigned char*)page->data;
+    const unsigned char* src = (const unsigned char*)source->data;
+
+    for (int dy = -ATLAS_PADDING; dy < slotHeight - ATLAS_PADDING; dy++)
+    {
+        int sy = dy < 0 ? 0 : (dy >= source->height ? source->height - 1 : dy);
+
+        for (int dx = -ATLAS_PADDING; dx < slotWidth - ATLAS_PADDING; dx++)
+        {
+            int sx = dx < 0 ? 0 : (dx >= source->width ? source->width - 1 : dx);
+            memcpy(&dst[((y + dy) * ATLAS_PAGE_SIZE + (x + dx)) * 4], &src[(sy * source->width + sx) * 4], 4);
+        }
+    }
+}
+
+static int PackImage(const char* key, Image image)
+{
+    int width = AlignSlot(image.width);
+    int height = AlignSlot(image.height);
+    int index = FindReleasedEntry(width, height);
+    int x, y, p;
+
+    if (index >= 0)
+    {
+        // Keeps the whole slot, so it can take the same size again later
+        p = atlasEntries[index].page;
+        x = atlasEntries[index].slotX;
+        y = atlasEntries[index].slotY;
+        width = atlasEntries[index].slotWidth;
+        height = atlasEntries[index].slotHeight;
+    }
+    else
+    {
+        if (entryCount >= MAX_ATLAS_ENTRIES) return -1;
+
+        for (p = 0; p < MAX_ATLAS_PAGES; p++)
+        {
+            if (p == atlasStats.pages && !OpenPage(p)) return -1;
+            if (PlaceInPage(&atlasPages[p], width, height, &x, &y)) break;
+        }
+        if (p == MAX_ATLAS_PAGES) return -1;
+        index = entryCount;
+    }
+
+    Image pixels = ImageCopy(image);
+    ImageFormat(&pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    if (!pixels.data) return -1;
+
+    BlitPadded(&atlasPages[p].image, &pixels, x + ATLAS_PADDING, y + ATLAS_PADDING, width, height);
+    UnloadImage(pixels);
+    atlasPages[p].dirty = true;
+
+    AtlasEntry* entry = &atlasEntries[index];
+    snprintf(entry->key, ATLAS_KEY_LENGTH, "%s", key);
+    entry->page = p;
+    entry->x = x + ATLAS_PADDING;
+    entry->y = y + ATLAS_PADDING;
+    entry->width = image.width;
+    entry->height = image.height;
+    entry->slotX = x;
+    entry->slotY = y;
+    entry->slotWidth = width;
+    entry->slotHeight = height;
+    entry->refs = 0;
+    entry->used = true;
+
+    if (index == entryCount) entryCount++;
+    atlasStats.entries++;
+    packedArea += (long)width * height;
+    UpdateUsage();
+    return index;
+}
+
+bool AddTextureToAtlas(const char* key, Image image, unsigned int textureId)
+{
+    if (!atlasStats.enabled || !key || !image.data) return false;
+
+    int entry = FindEntry(key);
+    if (entry < 0)
+    {
+        // Block-compressed data can't be copied texel by texel
+        if (image.width > ATLAS_MAX_ENTRY_SIZE || image.height > ATLAS_MAX_ENTRY_SIZE ||
+            image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+        {
+            atlasStats.rejected++;
+            return false;
+        }
+
+        entry = PackImage(key, image);
+        if (entry < 0)
+        {
+            printf("Warning: Texture atlas full, %s stays standalone\n", key);
+            atlasStats.rejected++;
+            return false;
+        }
+    }
+
+    return textureId == 0 || InsertSlot(textureId, entry);
+}
+
+void RemoveAtlasTexture(unsigned int textureId)
+{
+    if (textureId == 0) return;
+
+    // GL reuses ids, so a stale mapping would catch an unrelated texture
+    int slot = FindSlot(textureId);
+    if (slot < 0) return;
+
+    atlasSlots[slot].textureId = SLOT_REMOVED;
+    atlasStats.textures--;
+    DropReference(atlasSlots[slot].entry);
+}
+
+static bool UploadPage(AtlasPage* page)
+{
+    if (page->texture.id != 0 && !page->dirty) return true;
+
+    if (page->texture.id == 0)
+    {
+        page->texture = LoadTextureFromImage(page->image);
+        if (page->texture.id == 0) return false;
+    }
+    else
+    {
+        UpdateTexture(page->texture, page->image.data);
+    }
+
+    // Rebuilt from level 0 after every change; the alignment keeps each
+    // 2x2 reduction inside one slot for the first ATLAS_MIP_LEVELS levels
+    if (GetTextureLoadSettings()->mipmaps)
+    {
+        GenTextureMipmaps(&page->texture);
+        SetTextureFilter(page->texture, TEXTURE_FILTER_TRILINEAR);
+    }
+    else
+    {
+        SetTextureFilter(page->texture, TEXTURE_FILTER_BILINEAR);
+    }
+
+    atlasStats.uploads++;
+    page->dirty = false;
+    return true;
+}
+
+bool RemapAtlasTexture(unsigned int* textureId, float uvRect[4])
+{
+    uvRect[0] = 0.0f;
+    uvRect[1] = 0.0f;
+    uvRect[2] = 1.0f;
+    uvRect[3] = 1.0f;
+
+    if (*textureId == 0) return false;
+
+    int slot = FindSlot(*textureId);
+    if (slot < 0) return false;
+
+    AtlasEntry* entry = &atlasEntries[atlasSlots[slot].entry];
+    AtlasPage* page = &atlasPages[entry->page];
+    if (!UploadPage(page)) return false;
+
+    *textureId = page->texture.id;
+    uvRect[0] = (float)entry->x / ATLAS_PAGE_SIZE;
+    uvRect[1] = (float)entry->y / ATLAS_PAGE_SIZE;
+    uvRect[2] = (float)entry->width / ATLAS_PAGE_SIZE;
+    uvRect[3] = (float)entry->height / ATLAS_PAGE_SIZE;
+    return true;
+}
+
+bool ExportTextureAtlas(const char* fileName)
+{
+    if (!fileName) return false;
+
+    size_t capacity = 64 + (size_t)atlasStats.entries * (ATLAS_KEY_LENGTH + 64);
+    char* text = (char*)malloc(capacity);
+    if (!text) return false;
+
+    int length = snprintf(text, capacity, "QWEEATLAS %d %d %d %d\n", ATLAS_FILE_VERSION,
+                          ATLAS_PAGE_SIZE, atlasStats.pages, atlasStats.entries);
+
+    // Key last, so paths with spaces survive
+    for (int i = 0; i < entryCount; i++)
+    {
+        AtlasEntry* entry = &atlasEntries[i];
+        if (!entry->used) continue;
+        length += snprintf(text + length, capacity - length, "%d %d %d %d %d %s\n", entry->page,
+                           entry->x, entry->y, entry->width, entry->height, entry->key);
+    }
+
+    bool saved = SaveFileText(fileName, text);
+    free(text);
+
+    for (int p = 0; saved && p < atlasStats.pages; p++)
+    {
+        saved = ExportImage(atlasPages[p].image, TextFormat("%s.%d.png", fileName, p));
+    }
+
+    if (!saved) printf("Warning: Failed to export texture atlas %s\n", fileName);
+    else printf("Texture atlas exported: %s (%d pages, %d entries)\n", fileName, atlasStats.pages, atlasStats.entries);
+    return saved;
+}
+
+bool LoadTextureAtlas(const char* fileName)
+{
+    if (!fileName) return false;
+    if (atlasStats.entries > 0)
+    {
+        printf("Warning: Texture atlas already has entries, not loading %s\n", fileName);
+        return false;
+    }
+
+    char* text = LoadFileText(fileName);
+    if (!text) return false;
+
+    int version = 0, pageSize = 0, pages = 0, entries = 0, consumed = 0;
+    if (sscanf(text, "QWEEATLAS %d %d %d %d\n%n", &version, &pageSize, &pages, &entries, &consumed) != 4 ||
+        version != ATLAS_FILE_VERSION || pageSize != ATLAS_PAGE_SIZE ||
+        pages < 0 || pages > MAX_ATLAS_PAGES || entries < 0 || entries > MAX_ATLAS_ENTRIES)
+    {
+        printf("Warning: Texture atlas %s has an unsupported format\n", fileName);
+        UnloadFileText(text);
+        return false;
+    }
+
+    bool loaded = true;
+    const char* line = text + consumed;
+
+    for (int i = 0; loaded && i < entries; i++)
+    {
+        AtlasEntry* entry = &atlasEntries[i];
+        int keyStart = 0;
+
+        loaded = sscanf(line, "%d %d %d %d %d %n", &entry->page, &entry->x, &entry->y,
+                        &entry->width, &entry->height, &keyStart) == 5 &&
+                 entry->page >= 0 && entry->page < pages;
+        if (!loaded) break;
+
+        const char* key = line + keyStart;
+        const char* end = strchr(key, '\n');
+        int keyLength = end ? (int)(end - key) : (int)strlen(key);
+        if (keyLength > 0 && key[keyLength - 1] == '\r') keyLength--;
+        snprintf(entry->key, ATLAS_KEY_LENGTH, "%.*s", keyLength, key);
+
+        line = end ? end + 1 : key + keyLength;
+        entry->slotX = entry->x - ATLAS_PADDING;
+        entry->slotY = entry->y - ATLAS_PADDING;
+        entry->slotWidth = AlignSlot(entry->width);
+        entry->slotHeight = AlignSlot(entry->height);
+        entry->refs = 0;
+        entry->used = true;
+        packedArea += (long)entry->slotWidth * entry->slotHeight;
+    }
+    UnloadFileText(text);
+
+    for (int p = 0; loaded && p < pages; p++)
+    {
+        AtlasPage* page = &atlasPages[p];
+
+        memset(page, 0, sizeof(AtlasPage));
+        page->image = LoadImage(TextFormat("%s.%d.png", fileName, p));
+        ImageFormat(&page->image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        page->nextY = ATLAS_PAGE_SIZE;
+        page->dirty = true;
+        atlasStats.pages++;
+
+        loaded = page->image.data && page->image.width == ATLAS_PAGE_SIZE && page->image.height == ATLAS_PAGE_SIZE;
+    }
+
+    if (!loaded)
+    {
+        printf("Warning: Texture atlas %s is incomplete\n", fileName);
+        CloseTextureAtlas();
+        return false;
+    }
+
+    atlasStats.entries = entries;
+    entryCount = entries;
+    UpdateUsage();
+    printf("Texture atlas loaded: %s (%d pages, %d entries)\n", fileName, pages, entries);
+    return true;
+}
+
+void CloseTextureAtlas()
+{
+    for (int p = 0; p < atlasStats.pages; p++)
+    {
+        if (atlasPages[p].texture.id != 0) UnloadTexture(atlasPages[p].texture);
+        if (atlasPages[p].image.data) UnloadImage(atlasPages[p].image);
+    }
+
+    memset(atlasPages, 0, sizeof(atlasPages));
+    memset(atlasSlots, 0, sizeof(atlasSlots));
+    memset(atlasEntries, 0, sizeof(atlasEntries));
+    atlasStats = (AtlasStats){ .enabled = atlasStats.enabled };
+    entryCount = 0;
+    packedArea = 0;
+}
+
+void SetTextureAtlasEnabled(bool enabled)
+{
+    atlasStats.enabled = enabled;
+    printf("Texture atlas %s\n", enabled ? "enabled" : "disabled");
+}
+
+AtlasStats* GetAtlasStats()
+{
+    return &atlasStats;
+}
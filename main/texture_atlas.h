@@ -0,0 +1,71 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Texture Atlas Module
+//==================================================================
+
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define ATLAS_PAGE_SIZE 1024
+#define MAX_ATLAS_PAGES 4
+#define MAX_ATLAS_ENTRIES 256
+#define MAX_ATLAS_SHELVES 64
+#define ATLAS_MAX_ENTRY_SIZE 256      // larger textures stay standalone
+#define ATLAS_MIP_LEVELS 4            // page levels that sample only their own entry
+#define ATLAS_ALIGN (1 << (ATLAS_MIP_LEVELS - 1))   // slot origin and size, in texels
+#define ATLAS_PADDING ATLAS_ALIGN     // edge texels repeated, one left at the last clean level
+#define ATLAS_KEY_LENGTH 128
+#define ATLAS_TEXTURE_SLOTS 1024      // texture id lookup, power of two
+
+#define ATLAS_FILE_VERSION 2
+
+typedef struct
+{
+    bool enabled;
+    int pages;
+    int entries;
+    int textures;                   // loaded textures mapped to an entry
+    int released;                   // entries whose last texture unloaded
+    int rejected;                   // too large or out of space
+    int uploads;
+    float usage;                    // packed share of the allocated pages
+} AtlasStats;
+
+// Small diffuse textures are packed into shared pages as they load, keyed
+// by file path so repeated loads share one entry. A textureId of 0 packs
+// without mapping, for cooking; such entries stay until CloseTextureAtlas.
+// When the last texture mapped to an entry unloads, its slot is released
+// and reused by the next image that fits. Packing is CPU only, so it also
+// works without a window.
+bool AddTextureToAtlas(const char* key, Image image, unsigned int textureId);
+void RemoveAtlasTexture(unsigned int textureId);
+
+// Pages get mipmaps when the texture loader's are on. Slots are aligned and
+// padded so the first ATLAS_MIP_LEVELS levels never mix two entries; past
+// that an entry covers only a few pixels and its edges blend with the
+// neighbours'.
+//
+// Swaps a packed texture for its page and writes the UV rect (x, y, w, h)
+// to apply to 0..1 coordinates. Otherwise leaves the id alone, writes the
+// full rect and returns false. Uploads dirty pages, so main thread only.
+// Mapped textures keep resolving while the atlas is disabled, since their
+// standalone upload may already be gone.
+bool RemapAtlasTexture(unsigned int* textureId, float uvRect[4]);
+
+// Cooked builds: the manifest plus one PNG per page (fileName.N.png).
+// Loading must happen before textures are added; loaded pages are not
+// packed further and later entries go to new pages.
+bool ExportTextureAtlas(const char* fileName);
+bool LoadTextureAtlas(const char* fileName);
+void CloseTextureAtlas();
+
+// Only affects textures loaded afterwards
+void SetTextureAtlasEnabled(bool enabled);
+AtlasStats* GetAtlasStats();
+
+#endif
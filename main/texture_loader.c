@@ -0,0 +1,125 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Texture Loader Implementation
+//==================================================================
+
+#include "texture_loader.h"
+#include <stdio.h>
+#include <string.h>
+
+static TextureLoadSettings loadSettings = {
+    .mipmaps = true,
+    .preferCompressed = true,
+    .anisotropy = 4,
+    .atlasProxies = false
+};
+static TextureLoadStats loadStats = {0};
+
+static const char* compressedExtensions[] = { ".dds", ".ktx" };
+
+static long MipChainSize(int width, int height, int format, int levels)
+{
+    long size = 0;
+
+    for (int i = 0; i < levels; i++)
+    {
+        size += GetPixelDataSize(width, height, format);
+        width = (width > 1) ? width / 2 : 1;
+        height = (height > 1) ? height / 2 : 1;
+    }
+    return size;
+}
+
+static bool IsCompressedFormat(int format)
+{
+    return format >= PIXELFORMAT_COMPRESSED_DXT1_RGB;
+}
+
+// Containers raylib wasn't built with, or formats the GPU lacks, load as
+// an empty image or a zero texture; both send us back to the source
+static bool LoadCompressedSibling(const char* path, Image* image, Texture2D* texture)
+{
+    const char* extension = strrchr(path, '.');
+    const char* slash = strrchr(path, '/');
+    int baseLength = (extension && (!slash || extension > slash)) ? (int)(extension - path) : (int)strlen(path);
+
+    for (int i = 0; i < (int)(sizeof(compressedExtensions) / sizeof(compressedExtensions[0])); i++)
+    {
+        const char* candidate = TextFormat("%.*s%s", baseLength, path, compressedExtensions[i]);
+        if (!FileExists(candidate)) continue;
+
+        *image = LoadImage(candidate);
+        if (image->data && IsCompressedFormat(image->format))
+        {
+            *texture = LoadTextureFromImage(*image);
+            if (texture->id != 0) return true;
+        }
+
+        printf("Warning: Compressed texture %s not usable, loading %s\n", candidate, path);
+        loadStats.compressedFallbacks++;
+        UnloadImage(*image);
+        *image = (Image){0};
+    }
+    return false;
+}
+
+Texture2D LoadTextureOptimized(const char* path, Image* source)
+{
+    Image image = {0};
+    Texture2D texture = {0};
+    bool compressed = loadSettings.preferCompressed && LoadCompressedSibling(path, &image, &texture);
+
+    if (!compressed)
+    {
+        image = LoadImage(path);
+        texture = LoadTextureFromImage(image);
+    }
+
+    if (texture.id == 0)
+    {
+        UnloadImage(image);
+        if (source) *source = (Image){0};
+        return texture;
+    }
+
+    // Compressed levels can't be generated here; they ship in the file
+    if (loadSettings.mipmaps && !compressed && texture.mipmaps == 1) GenTextureMipmaps(&texture);
+
+    if (texture.mipmaps > 1)
+    {
+        SetTextureFilter(texture, TEXTURE_FILTER_TRILINEAR);
+        loadStats.mipmapped++;
+    }
+    else
+    {
+        SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+    }
+
+    if (loadSettings.anisotropy == 4) SetTextureFilter(texture, TEXTURE_FILTER_ANISOTROPIC_4X);
+    else if (loadSettings.anisotropy == 8) SetTextureFilter(texture, TEXTURE_FILTER_ANISOTROPIC_8X);
+    else if (loadSettings.anisotropy == 16) SetTextureFilter(texture, TEXTURE_FILTER_ANISOTROPIC_16X);
+
+    long uploaded = MipChainSize(texture.width, texture.height, texture.format, texture.mipmaps);
+    long baseline = MipChainSize(texture.width, texture.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, texture.mipmaps);
+
+    loadStats.texturesLoaded++;
+    if (compressed) loadStats.compressedLoaded++;
+    loadStats.bytesUploaded += uploaded;
+    if (compressed) loadStats.bytesSaved += baseline - uploaded;
+
+    if (source) *source = image;
+    else UnloadImage(image);
+    return texture;
+}
+
+TextureLoadSettings* GetTextureLoadSettings()
+{
+    return &loadSettings;
+}
+
+TextureLoadStats* GetTextureLoadStats()
+{
+    return &loadStats;
+}
@@ -0,0 +1,42 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Texture Loader Module
+//==================================================================
+
+#ifndef TEXTURE_LOADER_H
+#define TEXTURE_LOADER_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+typedef struct
+{
+    bool mipmaps;
+    bool preferCompressed;          // use a .dds/.ktx next to the source
+    int anisotropy;                 // 4, 8 or 16; anything else is off
+    bool atlasProxies;              // atlased object textures keep only a 1x1 upload, see objects.h
+} TextureLoadSettings;
+
+typedef struct
+{
+    int texturesLoaded;
+    int compressedLoaded;
+    int mipmapped;
+    int compressedFallbacks;        // container found but not usable
+    long bytesUploaded;             // all levels
+    long bytesSaved;                // compressed uploads versus RGBA8 with the same levels
+} TextureLoadStats;
+
+// For "wall.png" a pre-compressed "wall.dds" or "wall.ktx" is tried first
+// and kept if raylib and the GPU take its format, mips included. Otherwise
+// the source uploads as is and mips are generated on the GPU. Filtering is
+// trilinear when there are mips, plus anisotropy if set. If source is not
+// NULL it receives the uploaded image, for the caller to unload.
+Texture2D LoadTextureOptimized(const char* path, Image* source);
+
+TextureLoadSettings* GetTextureLoadSettings();
+TextureLoadStats* GetTextureLoadStats();
+
+#endif
@@ -0,0 +1,53 @@
+//==================================================================
+//QWEE Engine - Lightweight 3D Game Engine
+//Copyright (C) 2026 QWEE Development Team
+//
+//Texture Atlas Cook Tool (headless)
+//
+//Packs every image under a directory into texture atlas pages and
+//writes the manifest plus one PNG per page, for LoadTextureAtlas in
+//cooked builds. Keys are the paths as found, so run it from the
+//directory the game loads its textures relative to.
+//
+//Usage: atlas_cook <texture dir> <atlas file>
+//==================================================================
+
+#include "texture_atlas.h"
+#include <stdio.h>
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        printf("Usage: %s <texture dir> <atlas file>\n", argv[0]);
+        return 1;
+    }
+
+    if (!DirectoryExists(argv[1]))
+    {
+        printf("Warning: Texture directory %s not found\n", argv[1]);
+        return 1;
+    }
+
+    FilePathList files = LoadDirectoryFilesEx(argv[1], ".png;.bmp;.tga;.jpg", true);
+    int packed = 0;
+
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        Image image = LoadImage(files.paths[i]);
+        if (!image.data) continue;
+
+        // Too large or compressed images stay standalone at runtime too
+        if (AddTextureToAtlas(files.paths[i], image, 0)) packed++;
+        UnloadImage(image);
+    }
+    UnloadDirectoryFiles(files);
+
+    AtlasStats* stats = GetAtlasStats();
+    printf("Packed %d of %u images into %d pages (%.0f%% used), %d left standalone\n",
+           packed, files.count, stats->pages, stats->usage * 100.0f, stats->rejected);
+
+    bool saved = packed > 0 && ExportTextureAtlas(argv[2]);
+    CloseTextureAtlas();
+    return saved ? 0 : 1;
+}
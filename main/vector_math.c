@@ -47,4 +47,78 @@ Vector3 Vector3CrossProduct(Vector3 v1, Vector3 v2)
 float Vector3DotProduct(Vector3 v1, Vector3 v2)
 {
     return v1.x*v2.x + v1.y*v2.y + v1.z*v2.z;
-}
\ No newline at end of file
+}
+
+void MatrixToFloats(Matrix m, float* out)
+{
+    out[0] = m.m0;   out[1] = m.m1;   out[2] = m.m2;   out[3] = m.m3;
+    out[4] = m.m4;   out[5] = m.m5;   out[6] = m.m6;   out[7] = m.m7;
+    out[8] = m.m8;   out[9] = m.m9;   out[10] = m.m10; out[11] = m.m11;
+    out[12] = m.m12; out[13] = m.m13; out[14] = m.m14; out[15] = m.m15;
+}
+
+Matrix MatrixMul(Matrix left, Matrix right)
+{
+    float l[16], r[16], o[16];
+    MatrixToFloats(left, l);
+    MatrixToFloats(right, r);
+    
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            o[i*4 + j] = l[i*4 + 0]*r[0*4 + j] + l[i*4 + 1]*r[1*4 + j] +
+                         l[i*4 + 2]*r[2*4 + j] + l[i*4 + 3]*r[3*4 + j];
+        }
+    }
+    
+    return (Matrix){
+        o[0], o[4], o[8],  o[12],
+        o[1], o[5], o[9],  o[13],
+        o[2], o[6], o[10], o[14],
+        o[3], o[7], o[11], o[15]
+    };
+}
+
+// Same matrices raylib's BeginMode3D builds through rlgl
+Matrix MatrixLookAt(Vector3 eye, Vector3 target, Vector3 up)
+{
+    Vector3 vz = Vector3Normalize(Vector3Subtract(eye, target));
+    Vector3 vx = Vector3Normalize(Vector3CrossProduct(up, vz));
+    Vector3 vy = Vector3CrossProduct(vz, vx);
+
+    return (Matrix){
+        vx.x, vx.y, vx.z, -Vector3DotProduct(vx, eye),
+        vy.x, vy.y, vy.z, -Vector3DotProduct(vy, eye),
+        vz.x, vz.y, vz.z, -Vector3DotProduct(vz, eye),
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+}
+
+Matrix MatrixFrustum(double left, double right, double bottom, double top, double nearPlane, double farPlane)
+{
+    float rl = (float)(right - left);
+    float tb = (float)(top - bottom);
+    float fn = (float)(farPlane - nearPlane);
+
+    return (Matrix){
+        (float)nearPlane*2.0f/rl, 0.0f, (float)(right + left)/rl, 0.0f,
+        0.0f, (float)nearPlane*2.0f/tb, (float)(top + bottom)/tb, 0.0f,
+        0.0f, 0.0f, -(float)(farPlane + nearPlane)/fn, -(float)(farPlane*nearPlane*2.0)/fn,
+        0.0f, 0.0f, -1.0f, 0.0f
+    };
+}
+
+Matrix MatrixOrtho(double left, double right, double bottom, double top, double nearPlane, double farPlane)
+{
+    float rl = (float)(right - left);
+    float tb = (float)(top - bottom);
+    float fn = (float)(farPlane - nearPlane);
+
+    return (Matrix){
+        2.0f/rl, 0.0f, 0.0f, -(float)(left + right)/rl,
+        0.0f, 2.0f/tb, 0.0f, -(float)(top + bottom)/tb,
+        0.0f, 0.0f, -2.0f/fn, -(float)(farPlane + nearPlane)/fn,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+}
@@ -45,4 +45,13 @@ Vector3 Vector3Normalize(Vector3 v);
 Vector3 Vector3CrossProduct(Vector3 v1, Vector3 v2);
 float Vector3DotProduct(Vector3 v1, Vector3 v2);
 
+// Same conventions as raylib: column-major, MatrixMul(a, b) applies a then b
+Matrix MatrixMul(Matrix left, Matrix right);
+void MatrixToFloats(Matrix m, float* out);
+
+// View and projection matrices as rlgl builds them for BeginMode3D
+Matrix MatrixLookAt(Vector3 eye, Vector3 target, Vector3 up);
+Matrix MatrixFrustum(double left, double right, double bottom, double top, double nearPlane, double farPlane);
+Matrix MatrixOrtho(double left, double right, double bottom, double top, double nearPlane, double farPlane);
+
 #endif
\ No newline at end of file